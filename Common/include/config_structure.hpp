@@ -132,6 +132,8 @@ private:
   PoissonSolver,			/*!< \brief Flag to know if we are solving  poisson forces  in plasma solver. */
   Low_Mach_Precon,		/*!< \brief Flag to know if we are using a low Mach number preconditioner. */
   Low_Mach_Corr,			/*!< \brief Flag to know if we are using a low Mach number correction. */
+  Batched_Conv_Flow,		/*!< \brief Flag to know if the convective fluxes of the flow are computed in packs of edges. */
+  Batched_Visc_Flow,		/*!< \brief Flag to know if the viscous fluxes of the flow are computed in packs of edges. */
   GravityForce,			/*!< \brief Flag to know if the gravity force is incuded in the formulation. */
   SmoothNumGrid,			/*!< \brief Smooth the numerical grid. */
   AdaptBoundary,			/*!< \brief Adapt the elements on the boundary. */
@@ -660,6 +662,7 @@ private:
   unsigned short Output_FileFormat;	/*!< \brief Format of the output files. */
   unsigned short ActDisk_Jump;	/*!< \brief Format of the output files. */
   bool CFL_Adapt;      /*!< \brief Adaptive CFL number. */
+  bool Newton_Krylov;      /*!< \brief Jacobian-free Newton-Krylov solution of the flow equations. */
   bool HB_Precondition;    /*< \brief Flag to turn on harmonic balance source term preconditioning */
   su2double RefArea,		/*!< \brief Reference area for coefficient computation. */
   RefElemLength,				/*!< \brief Reference element length for computing the slope limiting epsilon. */
@@ -670,6 +673,7 @@ private:
   *RefOriginMoment_Y,      /*!< \brief Y Origin for moment computation. */
   *RefOriginMoment_Z,      /*!< \brief Z Origin for moment computation. */
   *CFL_AdaptParam,      /*!< \brief Information about the CFL ramp. */
+  *Newton_Krylov_Param,      /*!< \brief Pseudo-transient continuation parameters of the Newton-Krylov mode. */
   *RelaxFactor_Giles,      /*!< \brief Information about the under relaxation factor for Giles BC. */
   *CFL,
   *HTP_Axis,      /*!< \brief Location of the HTP axis. */
@@ -938,6 +942,7 @@ private:
   *default_eng_cyl,           /*!< \brief Default engine box array for the COption class. */
   *default_eng_val,           /*!< \brief Default engine box array values for the COption class. */
   *default_cfl_adapt,         /*!< \brief Default CFL adapt param array for the COption class. */
+  *default_nk_param,          /*!< \brief Default Newton-Krylov param array for the COption class. */
   *default_jst_coeff,         /*!< \brief Default artificial dissipation (flow) array for the COption class. */
   *default_ffd_coeff,         /*!< \brief Default artificial dissipation (flow) array for the COption class. */
   *default_mixedout_coeff,    /*!< \brief Default default mixedout algorithm coefficients for the COption class. */
@@ -1485,6 +1490,19 @@ public:
    */
   bool GetCFL_Adapt(void);
   
+  /*!
+   * \brief Get information about the Jacobian-free Newton-Krylov mode of the flow equations.
+   * \return <code>TRUE</code> if the flow linear systems use a finite difference matrix-vector product; otherwise <code>FALSE</code>.
+   */
+  bool GetNewton_Krylov(void);
+  
+  /*!
+   * \brief Get the pseudo-transient continuation parameters of the Newton-Krylov mode.
+   * \param[in] val_index - 0 for the exponent of the residual reduction, 1 for the maximum CFL number.
+   * \return Value of the parameter.
+   */
+  su2double GetNewton_Krylov_Param(unsigned short val_index);
+  
   /*!
    * \brief Get the values of the CFL adapation.
    * \return Value of CFL adapation
@@ -3815,6 +3833,13 @@ public:
    */
   unsigned short GetKind_TimeIntScheme_Flow(void);
   
+  /*!
+   * \brief Set the kind of integration scheme (explicit or implicit)
+   *        for the flow equations.
+   * \param[in] val_kind_timeintscheme - Kind of integration scheme for the flow equations.
+   */
+  void SetKind_TimeIntScheme_Flow(unsigned short val_kind_timeintscheme);
+  
   /*!
    * \brief Get the kind of integration scheme (explicit or implicit)
    *        for the flow equations.
@@ -5370,6 +5395,18 @@ public:
    */
   bool Low_Mach_Correction(void);
   
+  /*!
+   * \brief Get information about the batched computation of the convective fluxes of the flow.
+   * \return <code>TRUE</code> if the convective fluxes are computed in packs of edges; otherwise <code>FALSE</code>.
+   */
+  bool GetBatched_Conv_Flow(void);
+  
+  /*!
+   * \brief Get information about the batched computation of the viscous fluxes of the flow.
+   * \return <code>TRUE</code> if the viscous fluxes are computed in packs of edges; otherwise <code>FALSE</code>.
+   */
+  bool GetBatched_Visc_Flow(void);
+  
   /*!
    * \brief Get information about the poisson solver condition
    * \return <code>TRUE</code> if it is a poisson solver condition; otherwise <code>FALSE</code>.
@@ -43,6 +43,10 @@ inline su2double CConfig::GetCFL_AdaptParam(unsigned short val_index) { return C
 
 inline bool CConfig::GetCFL_Adapt(void) { return CFL_Adapt; }
 
+inline bool CConfig::GetNewton_Krylov(void) { return Newton_Krylov; }
+
+inline su2double CConfig::GetNewton_Krylov_Param(unsigned short val_index) { return Newton_Krylov_Param[val_index]; }
+
 inline bool CConfig::GetHB_Precondition(void) { return HB_Precondition; }
 
 inline void CConfig::SetInflow_Mach(unsigned short val_imarker, su2double val_fanface_mach) { Inflow_Mach[val_imarker] = val_fanface_mach; }
@@ -979,6 +983,8 @@ inline bool CConfig::GetMUSCL_AdjTurb(void) { return MUSCL_AdjTurb; }
 
 inline unsigned short CConfig::GetKind_TimeIntScheme_Flow(void) { return Kind_TimeIntScheme_Flow; }
 
+inline void CConfig::SetKind_TimeIntScheme_Flow(unsigned short val_kind_timeintscheme) { Kind_TimeIntScheme_Flow = val_kind_timeintscheme; }
+
 inline unsigned short CConfig::GetKind_TimeIntScheme_Wave(void) { return Kind_TimeIntScheme_Wave; }
 
 inline unsigned short CConfig::GetKind_TimeIntScheme_Heat(void) { return Kind_TimeIntScheme_Heat; }
@@ -1472,6 +1478,10 @@ inline bool CConfig::Low_Mach_Preconditioning(void) { return Low_Mach_Precon; }
 
 inline bool CConfig::Low_Mach_Correction(void) { return Low_Mach_Corr; }
 
+inline bool CConfig::GetBatched_Conv_Flow(void) { return Batched_Conv_Flow; }
+
+inline bool CConfig::GetBatched_Visc_Flow(void) { return Batched_Visc_Flow; }
+
 inline bool CConfig::GetGravityForce(void) { return GravityForce; }
 
 inline bool CConfig::GetBody_Force(void) { return Body_Force; }
@@ -63,6 +63,18 @@
 
 typedef double passivedouble;
 
+/*--- Type of the entries of the sparse matrices (Jacobians and preconditioners). The entries are stored
+ * in single precision when compiled with -DUSE_MIXED_PRECISION, while the vectors and the Krylov
+ * recurrences stay in su2double. The AD types keep the matrices active (and in full precision). ---*/
+
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+typedef su2double su2mixedfloat;
+#elif defined(USE_MIXED_PRECISION)
+typedef float su2mixedfloat;
+#else
+typedef passivedouble su2mixedfloat;
+#endif
+
 /*!
  * \namespace SU2_TYPE
  * \brief Namespace for defining the datatype wrapper routines; this class features as a base class for
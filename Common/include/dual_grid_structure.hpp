@@ -167,12 +167,13 @@ private:
   Agglomerate;                        /*!< \brief This flag indicates if the element has been agglomerated. */
   bool Move;                          /*!< \brief This flag indicates if the point is going to be move in the grid deformation process. */
   unsigned short color;               /*!< \brief Color of the point in the partitioning strategy. */
-  su2double Wall_Distance;            /*!< \brief Distance to the nearest wall. */
+  su2double *Wall_Distance;           /*!< \brief Distance to the nearest wall. */
   su2double SharpEdge_Distance;       /*!< \brief Distance to a sharp edge. */
   su2double Curvature;                /*!< \brief Value of the surface curvature (SU2_GEO). */
   unsigned long GlobalIndex;          /*!< \brief Global index in the parallel simulation. */
   unsigned short nNeighbor;           /*!< \brief Number of neighbors. */
   bool Flip_Orientation;              /*!< \brief Flip the orientation of the normal. */
+  bool Shared_Storage;                /*!< \brief Coordinates, volume and wall distance live in the contiguous arrays of the geometry. */
 
 public:
 	
@@ -207,6 +208,15 @@ public:
 	 * \brief Destructor of the class. 
 	 */
 	~CPoint(void);
+
+  /*!
+   * \brief Move the coordinates, volumes and wall distance of the point to external (contiguous) storage.
+   * \param[in] val_coord - Location for the <i>nDim</i> coordinates of the point.
+   * \param[in] val_volume - Location for the volumes of the control volume.
+   * \param[in] val_nvolume - Number of volumes stored (1 for steady, 3 for unsteady problems).
+   * \param[in] val_wall_distance - Location for the wall distance of the point.
+   */
+  void SetStorage(su2double *val_coord, su2double *val_volume, unsigned short val_nvolume, su2double *val_wall_distance);
 	
 	/*! 
 	 * \brief For parallel computation, its indicates if a point must be computed or not.
@@ -763,6 +773,7 @@ private:
 	su2double *Coord_CG;			/*!< \brief Center-of-gravity of the element. */
 	unsigned long *Nodes;		/*!< \brief Vector to store the global nodes of an element. */
 	su2double *Normal;				/*!< \brief Normal al elemento y coordenadas de su centro de gravedad. */
+  bool Shared_Storage;      /*!< \brief Nodes and normal live in the contiguous arrays of the geometry. */
 
 public:
 		
@@ -778,6 +789,13 @@ public:
 	 * \brief Destructor of the class. 
 	 */
 	~CEdge(void);
+
+  /*!
+   * \brief Move the nodes and the normal of the edge to external (contiguous) storage.
+   * \param[in] val_nodes - Location for the two nodes of the edge.
+   * \param[in] val_normal - Location for the <i>nDim</i> components of the normal.
+   */
+  void SetStorage(unsigned long *val_nodes, su2double *val_normal);
 	
 	/*! 
 	 * \brief Set the center of gravity of the edge.
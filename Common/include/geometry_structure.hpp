@@ -112,6 +112,20 @@ protected:
 	nMarker;				/*!< \brief Number of different markers of the mesh. */
   unsigned long Max_GlobalPoint;  /*!< \brief Greater global point in the domain local structure. */
 
+  /*--- Contiguous copies of the dual grid data, shared with the CPoint and CEdge objects ---*/
+  unsigned short nVolume;           /*!< \brief Number of volumes stored per point (1 for steady, 3 for unsteady problems). */
+  su2double *Point_Coord,           /*!< \brief Coordinates of all the points, stored as [iPoint*nDim+iDim]. */
+  *Point_Volume,                    /*!< \brief Volumes of all the control volumes, stored as [iPoint*nVolume+iVol]. */
+  *Point_WallDistance;              /*!< \brief Wall distance of all the points. */
+  unsigned long *Edge_Nodes;        /*!< \brief Edge-to-point table, stored as [iEdge*2+iNode]. */
+  su2double *Edge_Normal;           /*!< \brief Normals of all the edges, stored as [iEdge*nDim+iDim]. */
+  unsigned long *Adjacency_Ptr,     /*!< \brief Offsets of the neighbors of each point in the CSR adjacency (size nPoint+1). */
+  *Adjacency_Ind,                   /*!< \brief Neighboring points in the CSR adjacency. */
+  *Adjacency_Edge;                  /*!< \brief Edge connecting the point to each neighbor in the CSR adjacency. */
+  unsigned short nEdgeColor;        /*!< \brief Number of edge colors (groups of edges that do not share points). */
+  unsigned long *EdgeColor_Ptr,     /*!< \brief Offsets of each color in EdgeColor_Edge (size nEdgeColor+1). */
+  *EdgeColor_Edge;                  /*!< \brief Edges sorted by color. */
+
   /* --- Custom boundary variables --- */
   su2double **CustomBoundaryTemperature;
   su2double **CustomBoundaryHeatFlux;
@@ -150,6 +164,31 @@ public:
   su2double **TurboRadiusIn, **TurboRadiusOut; /*! <\brief Radius at each span wise section for each turbomachinery marker*/
 
   unsigned short nCommLevel;		/*!< \brief Number of non-blocking communication levels. */
+
+  /*--- Point-to-point (halo) communications of the SEND_RECEIVE markers, built once by PreprocessP2PComms ---*/
+  bool P2PComms_Preprocessed;       /*!< \brief Whether the point-to-point communications have been built. */
+  int nP2PSend,                     /*!< \brief Number of messages sent in a halo exchange (one per send marker). */
+  nP2PRecv;                         /*!< \brief Number of messages received in a halo exchange (one per receive marker). */
+  int *P2PSend_Rank,                /*!< \brief Destination rank of each sent message. */
+  *P2PRecv_Rank;                    /*!< \brief Source rank of each received message. */
+  unsigned long *P2PSend_Ptr,       /*!< \brief Offsets of each sent message in P2PSend_Point (size nP2PSend+1). */
+  *P2PRecv_Ptr,                     /*!< \brief Offsets of each received message in P2PRecv_Point (size nP2PRecv+1). */
+  *P2PSend_Point,                   /*!< \brief Local points packed in the sent messages. */
+  *P2PRecv_Point;                   /*!< \brief Local (halo) points unpacked from the received messages. */
+  unsigned short *P2PRecv_Rotation; /*!< \brief Periodic transformation of each received point. */
+  su2double *P2P_RotMatrix;         /*!< \brief Rotation matrix of each periodic transformation, stored as [iPeriodic*9+iDim*3+jDim]. */
+  unsigned short P2P_CountPerPoint; /*!< \brief Number of values per point that the buffers can hold. */
+  su2double *P2PSend_Buffer,        /*!< \brief Persistent buffer of the sent messages. */
+  *P2PRecv_Buffer;                  /*!< \brief Persistent buffer of the received messages. */
+  SU2_MPI::Request *P2PSend_Request,  /*!< \brief Requests of the sent messages. */
+  *P2PRecv_Request;                 /*!< \brief Requests of the received messages. */
+  SU2_MPI::Status *P2PSend_Status;  /*!< \brief Statuses of the sent messages. */
+
+  /*--- Geometric part of the least-squares gradient reconstruction, built by SetLeastSquares_Weights ---*/
+  bool LSQ_Weights_Updated;         /*!< \brief Whether the weights correspond to the current coordinates. */
+  unsigned long *LSQ_Weight_Ptr;    /*!< \brief Offsets of the neighbors of each point in LSQ_Weight (size nPoint+1). */
+  su2double *LSQ_Weight,            /*!< \brief Coordinate difference and squared distance of each point-neighbor pair, nDim+1 values per pair. */
+  *LSQ_Smatrix;                     /*!< \brief Matrix inv(R)*transpose(inv(R)) of each point, nDim x nDim values per point. */
 	vector<unsigned long> PeriodicPoint[MAX_NUMBER_PERIODIC][2];			/*!< \brief PeriodicPoint[Periodic bc] and return the point that
 																			 must be sent [0], and the image point in the periodic bc[1]. */
 	vector<unsigned long> PeriodicElem[MAX_NUMBER_PERIODIC];				/*!< \brief PeriodicElem[Periodic bc] and return the elements that 
@@ -433,6 +472,161 @@ public:
 	 */
 	void SetEdges(void);
 
+  /*!
+   * \brief Store the coordinates, volumes, wall distance and edge data in contiguous arrays,
+   *        and build the point adjacency in CSR format. The CPoint and CEdge objects are
+   *        pointed to these arrays, hence their accessors remain valid.
+   * \note Must be called again if the edge or point structures are rebuilt.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetDualGrid_Storage(CConfig *config);
+
+  /*!
+   * \brief Group the edges in colors such that no two edges of the same color share a point,
+   *        the edges of a color can then be processed concurrently without data races.
+   * \param[in] val_nthread - Number of threads that will process the edge loops, if it is 1
+   *            a single color with all the edges (in their natural order) is used.
+   */
+  void SetEdge_Coloring(unsigned short val_nthread);
+
+  /*!
+   * \brief Get the number of edge colors.
+   * \return Number of edge colors.
+   */
+  unsigned short GetnEdgeColor(void);
+
+  /*!
+   * \brief Get the offsets of each color in the list of colored edges.
+   * \return Pointer to the <i>nEdgeColor+1</i> offsets.
+   */
+  unsigned long *GetEdgeColor_Ptr(void);
+
+  /*!
+   * \brief Get the list of edges sorted by color.
+   * \return Pointer to the colored edges.
+   */
+  unsigned long *GetEdgeColor_Edge(void);
+
+  /*!
+   * \brief Build the point-to-point (halo) communications from the SEND_RECEIVE markers: neighbor ranks,
+   *        points of each message and periodic rotations. The buffers are allocated on demand and reused.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void PreprocessP2PComms(CConfig *config);
+
+  /*!
+   * \brief Make sure that the persistent buffers can hold <i>val_countPerPoint</i> values per point.
+   * \param[in] val_countPerPoint - Number of values exchanged per point.
+   */
+  void AllocateP2PComms(unsigned short val_countPerPoint);
+
+  /*!
+   * \brief Post the non-blocking receives of all the messages of a halo exchange.
+   * \param[in] val_countPerPoint - Number of values exchanged per point.
+   */
+  void PostP2PRecvs(unsigned short val_countPerPoint);
+
+  /*!
+   * \brief Post the non-blocking sends of all the messages of a halo exchange,
+   *        the send buffer must have been packed by the caller.
+   * \param[in] val_countPerPoint - Number of values exchanged per point.
+   */
+  void PostP2PSends(unsigned short val_countPerPoint);
+
+  /*!
+   * \brief Wait for any of the received messages to complete.
+   * \param[in] val_iMessage - Number of messages already completed (used when compiled without MPI).
+   * \return Index of the completed message.
+   */
+  int WaitAnyP2PRecv(int val_iMessage);
+
+  /*!
+   * \brief Wait for all the sent messages to complete, after which the send buffer can be reused.
+   */
+  void WaitAllP2PSends(void);
+
+  /*!
+   * \brief Compute the geometric part of the inverse distance weighted least-squares gradient: the
+   *        coordinate differences and squared distances to the neighbors, and the matrix S of each point.
+   *        Nothing is done if the coordinates did not change since the last call (see SetControlVolume).
+   */
+  void SetLeastSquares_Weights(void);
+
+  /*!
+   * \brief Get the least-squares data of the neighbors of a point.
+   * \param[in] val_point - Point.
+   * \return Pointer to <i>nDim</i>+1 values per neighbor (x_j-x_i and |x_j-x_i|^2), in the order of CPoint::GetPoint.
+   *         A zero squared distance means that the neighbor does not contribute.
+   */
+  su2double *GetLeastSquares_Weights(unsigned long val_point);
+
+  /*!
+   * \brief Get the least-squares matrix S of a point, such that the gradient is S times the weighted sum
+   *        of (x_j-x_i)*(U_j-U_i)/|x_j-x_i|^2 over the neighbors.
+   * \param[in] val_point - Point.
+   * \return Pointer to the <i>nDim</i> x <i>nDim</i> matrix, stored row by row (zero for singular points).
+   */
+  su2double *GetLeastSquares_Smatrix(unsigned long val_point);
+
+  /*!
+   * \brief Check if the contiguous dual grid arrays have been built.
+   * \return <code>TRUE</code> if SetDualGrid_Storage has been called; otherwise <code>FALSE</code>.
+   */
+  bool GetDualGrid_Storage(void);
+
+  /*!
+   * \brief Get the coordinates of a point from the contiguous storage.
+   * \param[in] val_point - Index of the point.
+   * \return Pointer to the <i>nDim</i> coordinates of the point.
+   */
+  su2double *GetPoint_Coord(unsigned long val_point);
+
+  /*!
+   * \brief Get the volume (at time n+1) of a control volume from the contiguous storage.
+   * \param[in] val_point - Index of the point.
+   * \return Volume of the control volume.
+   */
+  su2double GetPoint_Volume(unsigned long val_point);
+
+  /*!
+   * \brief Get the wall distance of a point from the contiguous storage.
+   * \param[in] val_point - Index of the point.
+   * \return Distance to the nearest wall.
+   */
+  su2double GetPoint_WallDistance(unsigned long val_point);
+
+  /*!
+   * \brief Get the nodes of an edge from the edge-to-point table.
+   * \param[in] val_edge - Index of the edge.
+   * \return Pointer to the two nodes of the edge.
+   */
+  unsigned long *GetEdge_Nodes(unsigned long val_edge);
+
+  /*!
+   * \brief Get the normal of an edge from the contiguous storage.
+   * \param[in] val_edge - Index of the edge.
+   * \return Pointer to the <i>nDim</i> components of the normal.
+   */
+  su2double *GetEdge_Normal(unsigned long val_edge);
+
+  /*!
+   * \brief Get the row offsets of the CSR point adjacency.
+   * \return Pointer to the <i>nPoint+1</i> offsets.
+   */
+  unsigned long *GetAdjacency_Ptr(void);
+
+  /*!
+   * \brief Get the column indices (neighboring points) of the CSR point adjacency.
+   * \return Pointer to the neighbors of all the points.
+   */
+  unsigned long *GetAdjacency_Ind(void);
+
+  /*!
+   * \brief Get the edges associated with the entries of the CSR point adjacency.
+   * \return Pointer to the edge index of each neighbor of all the points.
+   */
+  unsigned long *GetAdjacency_Edge(void);
+
 	/*! 
 	 * \brief A virtual member.
 	 */
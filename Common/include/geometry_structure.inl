@@ -183,6 +183,34 @@ inline void CGeometry::SetnVertexSpanMax(unsigned short marker_flag, unsigned lo
 
 inline unsigned long CGeometry::GetnEdge(void) { return nEdge; }
 
+inline bool CGeometry::GetDualGrid_Storage(void) { return (Edge_Nodes != NULL); }
+
+inline su2double *CGeometry::GetPoint_Coord(unsigned long val_point) { return &Point_Coord[val_point*nDim]; }
+
+inline su2double CGeometry::GetPoint_Volume(unsigned long val_point) { return Point_Volume[val_point*nVolume]; }
+
+inline su2double CGeometry::GetPoint_WallDistance(unsigned long val_point) { return Point_WallDistance[val_point]; }
+
+inline unsigned long *CGeometry::GetEdge_Nodes(unsigned long val_edge) { return &Edge_Nodes[val_edge*2]; }
+
+inline su2double *CGeometry::GetEdge_Normal(unsigned long val_edge) { return &Edge_Normal[val_edge*nDim]; }
+
+inline unsigned long *CGeometry::GetAdjacency_Ptr(void) { return Adjacency_Ptr; }
+
+inline unsigned long *CGeometry::GetAdjacency_Ind(void) { return Adjacency_Ind; }
+
+inline unsigned long *CGeometry::GetAdjacency_Edge(void) { return Adjacency_Edge; }
+
+inline unsigned short CGeometry::GetnEdgeColor(void) { return nEdgeColor; }
+
+inline unsigned long *CGeometry::GetEdgeColor_Ptr(void) { return EdgeColor_Ptr; }
+
+inline unsigned long *CGeometry::GetEdgeColor_Edge(void) { return EdgeColor_Edge; }
+
+inline su2double *CGeometry::GetLeastSquares_Weights(unsigned long val_point) { return &LSQ_Weight[LSQ_Weight_Ptr[val_point]*(nDim+1)]; }
+
+inline su2double *CGeometry::GetLeastSquares_Smatrix(unsigned long val_point) { return &LSQ_Smatrix[val_point*nDim*nDim]; }
+
 inline bool CGeometry::FindFace(unsigned long first_elem, unsigned long second_elem, unsigned short &face_first_elem, unsigned short &face_second_elem) { return 0;}
 
 inline void CGeometry::SetBoundVolume(void) { }
@@ -39,6 +39,7 @@
 #pragma once
 
 #include "./mpi_structure.hpp"
+#include "./omp_structure.hpp"
 #include <limits>
 #include <iostream>
 #include <cmath>
@@ -67,8 +68,8 @@ private:
   nPointDomain,           /*!< \brief Number of points in the grid. */
   nVar,                   /*!< \brief Number of variables. */
   nEqn;                   /*!< \brief Number of equations. */
-  su2double *matrix;            /*!< \brief Entries of the sparse matrix. */
-  su2double *ILU_matrix;         /*!< \brief Entries of the ILU sparse matrix. */
+  su2mixedfloat *matrix;        /*!< \brief Entries of the sparse matrix. */
+  su2mixedfloat *ILU_matrix;     /*!< \brief Entries of the ILU sparse matrix. */
   unsigned long nnz;                 /*!< \brief Number of possible nonzero entries in the matrix. */
   unsigned long *row_ptr;            /*!< \brief Pointers to the first element in each row. */
   unsigned long *col_ind;            /*!< \brief Column index for each of the elements in val(). */
@@ -77,23 +78,173 @@ private:
   unsigned long *col_ind_ilu;        /*!< \brief Column index for each of the elements in val() (ILU). */
   unsigned short ilu_fill_in;        /*!< \brief Fill in level for the ILU preconditioner. */
   
-  su2double *block;             /*!< \brief Internal array to store a subblock of the matrix. */
-  su2double *block_inverse;             /*!< \brief Internal array to store a subblock of the matrix. */
-  su2double *block_weight;             /*!< \brief Internal array to store a subblock of the matrix. */
+  su2mixedfloat *block;         /*!< \brief Internal array to store a subblock of the matrix. */
+  su2mixedfloat *block_inverse;         /*!< \brief Internal array to store a subblock of the matrix. */
+  su2mixedfloat *block_weight;         /*!< \brief Internal array to store a subblock of the matrix. */
   su2double *prod_block_vector; /*!< \brief Internal array to store the product of a subblock with a vector. */
   su2double *prod_row_vector;   /*!< \brief Internal array to store the product of a matrix-by-blocks "row" with a vector. */
   su2double *aux_vector;         /*!< \brief Auxiliary array to store intermediate results. */
   su2double *sum_vector;         /*!< \brief Auxiliary array to store intermediate results. */
-  su2double *invM;              /*!< \brief Inverse of (Jacobi) preconditioner. */
+  su2mixedfloat *invM;          /*!< \brief Inverse of (Jacobi) preconditioner. */
   
   bool *LineletBool;                          /*!< \brief Identify if a point belong to a linelet. */
   vector<unsigned long> *LineletPoint;        /*!< \brief Linelet structure. */
   unsigned long nLinelet;                     /*!< \brief Number of Linelets in the system. */
-  su2double **UBlock, **invUBlock, **LBlock,
-  **yVector, **zVector, **rVector, *LFBlock,
-  *LyVector, *FzVector;           /*!< \brief Arrays of the Linelet preconditioner methodology. */
+  su2mixedfloat **UBlock, **invUBlock, **LBlock,
+  *LFBlock;                       /*!< \brief Blocks of the Linelet preconditioner methodology. */
+  su2double **yVector, **zVector, **rVector,
+  *LyVector, *FzVector;           /*!< \brief Vectors of the Linelet preconditioner methodology. */
   unsigned long max_nElem;
   
+  unsigned long *dia_ptr;       /*!< \brief Position of the diagonal block of each row. */
+  unsigned long nEdge;          /*!< \brief Number of edges of the edge-based structure. */
+  unsigned long *edge_ptr;      /*!< \brief Positions of the ii, ij, ji and jj blocks of each edge. */
+  
+  unsigned long nRow_Send;      /*!< \brief Number of owned rows that are sent to other ranks after a product. */
+  unsigned long *Row_Order;     /*!< \brief Owned rows, sorted such that the rows that are sent come first. */
+  su2double *Halo_Buffer_Send,  /*!< \brief Send buffer of the non-blocking halo exchange. */
+  *Halo_Buffer_Recv;            /*!< \brief Receive buffer of the non-blocking halo exchange. */
+  SU2_MPI::Request *Halo_Request; /*!< \brief Requests of the non-blocking halo exchange. */
+  int nHalo_Request;            /*!< \brief Number of active requests of the non-blocking halo exchange. */
+  
+  unsigned short nAMG_Level;    /*!< \brief Number of levels of the AMG hierarchy (the first one is the matrix itself), 0 if not built. */
+  unsigned short AMG_nSweep;    /*!< \brief Number of pre and post smoothing sweeps (block Gauss-Seidel) of the AMG cycle. */
+  unsigned long *AMG_nBlk,      /*!< \brief Number of (owned) block rows of each level. */
+  *AMG_nnz,                     /*!< \brief Number of blocks of each level. */
+  **AMG_row_ptr, **AMG_col_ind, /*!< \brief Sparse structure of each level. */
+  **AMG_dia_ptr,                /*!< \brief Position of the diagonal blocks of each level. */
+  **AMG_Parent,                 /*!< \brief Aggregate (row of the next level) that contains each row of a level. */
+  **AMG_Galerkin;               /*!< \brief Position in the next level of each block of a level (AMG_nnz of the next level if dropped). */
+  su2mixedfloat **AMG_matrix,   /*!< \brief Entries of each level. */
+  **AMG_invDiag;                /*!< \brief Inverse of the diagonal blocks of each level. */
+  su2double **AMG_Rhs, **AMG_Sol, **AMG_Res; /*!< \brief Right hand side, solution and residual of each level. */
+  su2double *AMG_Coarse_LU;     /*!< \brief Dense LU factorization of the coarsest level. */
+  unsigned long *AMG_Coarse_Perm; /*!< \brief Row permutation (pivoting) of the dense LU factorization. */
+  
+  /*!
+   * \brief Position of block (block_i, block_j) in the sparse structure, by search (or direct for the diagonal).
+   * \param[in] block_i - Row index.
+   * \param[in] block_j - Column index.
+   * \return Position of the block, nnz if the block is not in the structure.
+   */
+  unsigned long GetBlock_Position(unsigned long block_i, unsigned long block_j) const;
+  
+  /*!
+   * \brief Store the positions of the diagonal blocks, and of the blocks of each edge if the structure is edge-based.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] EdgeConnect - The sparse structure is given by the edges of the geometry.
+   */
+  void SetBlock_Positions(CGeometry *geometry, bool EdgeConnect);
+  
+  /*!
+   * \brief Sort the owned rows such that those sent to other ranks by SendReceive_Solution come first.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetRow_Order(CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Product of a range of (reordered) rows of the matrix by a vector, for a fixed block size.
+   * \param[in] vec - Values of the vector to be multiplied by the matrix.
+   * \param[out] prod - Values of the result of the product.
+   * \param[in] iRow_begin - First position in Row_Order.
+   * \param[in] iRow_end - Last position (not included) in Row_Order.
+   */
+  template<unsigned short nBlk>
+  void RowRangeProduct(const su2double *vec, su2double *prod, unsigned long iRow_begin, unsigned long iRow_end) const;
+  
+  /*!
+   * \brief Product of a range of (reordered) rows of the matrix by a vector, for any block size.
+   * \param[in] vec - Values of the vector to be multiplied by the matrix.
+   * \param[out] prod - Values of the result of the product.
+   * \param[in] iRow_begin - First position in Row_Order.
+   * \param[in] iRow_end - Last position (not included) in Row_Order.
+   */
+  void RowRangeProduct_Generic(const su2double *vec, su2double *prod, unsigned long iRow_begin, unsigned long iRow_end) const;
+  
+  /*!
+   * \brief Dispatch the product of a range of rows to the kernel of the current block size.
+   * \param[in] vec - Values of the vector to be multiplied by the matrix.
+   * \param[out] prod - Values of the result of the product.
+   * \param[in] iRow_begin - First position in Row_Order.
+   * \param[in] iRow_end - Last position (not included) in Row_Order.
+   */
+  void RowRangeProduct_Block(const su2double *vec, su2double *prod, unsigned long iRow_begin, unsigned long iRow_end) const;
+  
+  void (*Block_MatVec)(unsigned short, const su2mixedfloat*, const su2double*, su2double*);  /*!< \brief Block by vector product for the block size of the matrix. */
+  void (*Block_MatMat)(unsigned short, const su2mixedfloat*, const su2mixedfloat*, su2mixedfloat*);  /*!< \brief Block by block product for the block size of the matrix. */
+  void (*Block_Solve)(unsigned short, const su2mixedfloat*, su2double*, su2mixedfloat*);       /*!< \brief Gauss elimination for the block size of the matrix. */
+  void (*Block_Inverse)(unsigned short, const su2mixedfloat*, su2mixedfloat*, su2mixedfloat*);       /*!< \brief Block inversion for the block size of the matrix. */
+  
+  /*!
+   * \brief Select the dense block kernels that match nVar (fixed-size versions for the common sizes).
+   */
+  void SetBlock_Kernels(void);
+  
+  /*!
+   * \brief Block by vector product c = a*b, for a fixed block size (nBlk = 0 uses val_n).
+   * \param[in] val_n - Block size, used only by the generic version.
+   * \param[in] a - Block.
+   * \param[in] b - Vector.
+   * \param[out] c - Result of the product.
+   */
+  template<unsigned short nBlk>
+  static void BlockKernel_MatVec(unsigned short val_n, const su2mixedfloat *a, const su2double *b, su2double *c);
+  
+  /*!
+   * \brief Block by block product c = a*b, for a fixed block size (nBlk = 0 uses val_n).
+   * \param[in] val_n - Block size, used only by the generic version.
+   * \param[in] a - Left block.
+   * \param[in] b - Right block.
+   * \param[out] c - Result of the product.
+   */
+  template<unsigned short nBlk>
+  static void BlockKernel_MatMat(unsigned short val_n, const su2mixedfloat *a, const su2mixedfloat *b, su2mixedfloat *c);
+  
+  /*!
+   * \brief Solve Block*x = rhs by Gauss elimination, for a fixed block size (nBlk = 0 uses val_n).
+   * \param[in] val_n - Block size, used only by the generic version.
+   * \param[in] Block - Matrix of the system (not modified).
+   * \param[in,out] rhs - Right hand side on input, solution on output.
+   * \param[in] work - Scratch space of val_n*val_n, used only by the generic version.
+   */
+  template<unsigned short nBlk>
+  static void BlockKernel_Solve(unsigned short val_n, const su2mixedfloat *Block, su2double *rhs, su2mixedfloat *work);
+  
+  /*!
+   * \brief Invert a block by Gauss elimination, for a fixed block size (nBlk = 0 uses val_n).
+   * \param[in] val_n - Block size, used only by the generic version.
+   * \param[in] Block - Block to be inverted (not modified).
+   * \param[out] invBlock - Inverse of the block.
+   * \param[in] work - Scratch space of val_n*val_n, used only by the generic version.
+   */
+  template<unsigned short nBlk>
+  static void BlockKernel_Inverse(unsigned short val_n, const su2mixedfloat *Block, su2mixedfloat *invBlock, su2mixedfloat *work);
+  
+  /*!
+   * \brief Build the structure of the AMG hierarchy: aggregation of the rows of each level and Galerkin sparse structure of the next one.
+   */
+  void SetAMG_Hierarchy(void);
+  
+  /*!
+   * \brief Residual r = b - A*x of a level of the AMG hierarchy (the columns of the halo points are dropped).
+   * \param[in] iLevel - Level of the hierarchy.
+   */
+  void AMG_Residual(unsigned short iLevel);
+  
+  /*!
+   * \brief Block Gauss-Seidel sweep on a level of the AMG hierarchy (the columns of the halo points are dropped).
+   * \param[in] iLevel - Level of the hierarchy.
+   * \param[in] forward - Order of the sweep, forward (pre-smoothing) or backward (post-smoothing).
+   */
+  void AMG_Smooth(unsigned short iLevel, bool forward);
+  
+  /*!
+   * \brief Approximate solution of a level of the AMG hierarchy with a V cycle, the coarsest level is solved exactly.
+   * \param[in] iLevel - Level of the hierarchy, AMG_Rhs is the input and AMG_Sol the output.
+   */
+  void AMG_Cycle(unsigned short iLevel);
+  
 public:
   
   /*!
@@ -149,7 +300,7 @@ public:
    * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
    * \param[in] block_j - Indexes of the block in the matrix-by-blocks structure.
    */
-  su2double *GetBlock(unsigned long block_i, unsigned long block_j);
+  su2mixedfloat *GetBlock(unsigned long block_i, unsigned long block_j);
   
   /*!
    * \brief Copies the block (i, j) of the matrix-by-blocks structure in the internal variable *block.
@@ -190,12 +341,46 @@ public:
    */
   void SubtractBlock(unsigned long block_i, unsigned long block_j, su2double **val_block);
   
+  /*!
+   * \brief Update the four blocks of an edge (i,j) with the Jacobians of a flux that is added to i and subtracted from j.
+   * \param[in] iEdge - Index of the edge, the blocks are updated without searching the sparse structure.
+   * \param[in] block_i - Jacobian of the flux with respect to the variables of point i.
+   * \param[in] block_j - Jacobian of the flux with respect to the variables of point j.
+   */
+  void UpdateBlocks(unsigned long iEdge, su2double **block_i, su2double **block_j);
+  
+  /*!
+   * \brief Update the four blocks of an edge (i,j) with the Jacobians of a flux that is subtracted from i and added to j.
+   * \param[in] iEdge - Index of the edge, the blocks are updated without searching the sparse structure.
+   * \param[in] block_i - Jacobian of the flux with respect to the variables of point i.
+   * \param[in] block_j - Jacobian of the flux with respect to the variables of point j.
+   */
+  void UpdateBlocks_Sub(unsigned long iEdge, su2double **block_i, su2double **block_j);
+  
+  /*!
+   * \brief Update the four blocks of an edge, as UpdateBlocks, with Jacobians stored in strided arrays.
+   * \param[in] iEdge - Index of the edge, the blocks are updated without searching the sparse structure.
+   * \param[in] block_i - Jacobian w.r.t. point i, entry (iVar,jVar) is at [(iVar*nEqn+jVar)*val_stride].
+   * \param[in] block_j - Jacobian w.r.t. point j, entry (iVar,jVar) is at [(iVar*nEqn+jVar)*val_stride].
+   * \param[in] val_stride - Distance between consecutive entries (e.g. the size of a pack of edges).
+   */
+  void UpdateBlocks(unsigned long iEdge, su2double *block_i, su2double *block_j, unsigned short val_stride);
+  
+  /*!
+   * \brief Update the four blocks of an edge, as UpdateBlocks_Sub, with Jacobians stored in strided arrays.
+   * \param[in] iEdge - Index of the edge, the blocks are updated without searching the sparse structure.
+   * \param[in] block_i - Jacobian w.r.t. point i, entry (iVar,jVar) is at [(iVar*nEqn+jVar)*val_stride].
+   * \param[in] block_j - Jacobian w.r.t. point j, entry (iVar,jVar) is at [(iVar*nEqn+jVar)*val_stride].
+   * \param[in] val_stride - Distance between consecutive entries (e.g. the size of a pack of edges).
+   */
+  void UpdateBlocks_Sub(unsigned long iEdge, su2double *block_i, su2double *block_j, unsigned short val_stride);
+  
   /*!
    * \brief Copies the block (i, j) of the matrix-by-blocks structure in the internal variable *block.
    * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
    * \param[in] block_j - Indexes of the block in the matrix-by-blocks structure.
    */
-  su2double *GetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j);
+  su2mixedfloat *GetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j);
   
   /*!
    * \brief Set the value of a block in the sparse matrix.
@@ -203,7 +388,7 @@ public:
    * \param[in] block_j - Indexes of the block in the matrix-by-blocks structure.
    * \param[in] **val_block - Block to set to A(i, j).
    */
-  void SetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j, su2double *val_block);
+  void SetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j, su2mixedfloat *val_block);
   
   
   /*!
@@ -212,7 +397,7 @@ public:
    * \param[in] block_j - Indexes of the block in the matrix-by-blocks structure.
    * \param[in] **val_block - Block to set to A(i, j).
    */
-  void SetBlockTransposed_ILUMatrix(unsigned long block_i, unsigned long block_j, su2double *val_block);
+  void SetBlockTransposed_ILUMatrix(unsigned long block_i, unsigned long block_j, su2mixedfloat *val_block);
   
   /*!
    * \brief Subtracts the specified block to the sparse matrix.
@@ -220,7 +405,7 @@ public:
    * \param[in] block_j - Indexes of the block in the matrix-by-blocks structure.
    * \param[in] **val_block - Block to subtract to A(i, j).
    */
-  void SubtractBlock_ILUMatrix(unsigned long block_i, unsigned long block_j, su2double *val_block);
+  void SubtractBlock_ILUMatrix(unsigned long block_i, unsigned long block_j, su2mixedfloat *val_block);
   
   /*!
    * \brief Adds the specified value to the diagonal of the (i, i) subblock
@@ -244,7 +429,7 @@ public:
    * \param[in] vector
    * \param[out] product
    */
-  void MatrixVectorProduct(su2double *matrix, su2double *vector, su2double *product);
+  void MatrixVectorProduct(su2mixedfloat *matrix, su2double *vector, su2double *product);
   
   /*!
    * \brief Calculates the matrix-matrix product
@@ -252,7 +437,7 @@ public:
    * \param[in] matrix_b
    * \param[out] product
    */
-  void MatrixMatrixProduct(su2double *matrix_a, su2double *matrix_b, su2double *product);
+  void MatrixMatrixProduct(su2mixedfloat *matrix_a, su2mixedfloat *matrix_b, su2mixedfloat *product);
   
   /*!
    * \brief Deletes the values of the row i of the sparse matrix.
@@ -298,7 +483,7 @@ public:
    * \param[in] rhs - Right-hand-side of the linear system.
    * \return Solution of the linear system (overwritten on rhs).
    */
-  void Gauss_Elimination(su2double* Block, su2double* rhs);
+  void Gauss_Elimination(su2mixedfloat* Block, su2double* rhs);
   
   /*!
    * \brief Performs the Gauss Elimination algorithm to solve the linear subsystem of the (i, i) subblock and rhs.
@@ -350,6 +535,22 @@ public:
    */
   void SendReceive_Solution(CSysVector & x, CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Start a non-blocking send receive of the solution (the values to send must already be computed).
+   * \param[in] x - Solution.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SendReceive_Solution_Start(CSysVector & x, CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Complete a non-blocking send receive of the solution started with SendReceive_Solution_Start.
+   * \param[in] x - Solution.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SendReceive_Solution_Finish(CSysVector & x, CGeometry *geometry, CConfig *config);
+  
   /*!
    * \brief Send receive the solution using MPI and the transposed structure of the matrix.
    * \param[in] x - Solution..
@@ -395,17 +596,17 @@ public:
   /*!
    * \brief Performs the product of two block matrices.
    */
-  void GetMultBlockBlock(su2double *c, su2double *a, su2double *b);
+  void GetMultBlockBlock(su2mixedfloat *c, su2mixedfloat *a, su2mixedfloat *b);
   
   /*!
    * \brief Performs the product of a block matrices by a vector.
    */
-  void GetMultBlockVector(su2double *c, su2double *a, su2double *b);
+  void GetMultBlockVector(su2double *c, su2mixedfloat *a, su2double *b);
   
   /*!
    * \brief Performs the subtraction of two matrices.
    */
-  void GetSubsBlock(su2double *c, su2double *a, su2double *b);
+  void GetSubsBlock(su2mixedfloat *c, su2mixedfloat *a, su2mixedfloat *b);
   
   /*!
    * \brief Performs the subtraction of two vectors.
@@ -417,21 +618,21 @@ public:
    * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
    * \param[out] invBlock - Inverse block.
    */
-  void InverseDiagonalBlock(unsigned long block_i, su2double *invBlock, bool transpose = false);
+  void InverseDiagonalBlock(unsigned long block_i, su2mixedfloat *invBlock, bool transpose = false);
   
  	/*!
    * \brief Inverse diagonal block.
    * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
    * \param[out] invBlock - Inverse block.
    */
-  void InverseDiagonalBlock_ILUMatrix(unsigned long block_i, su2double *invBlock);
+  void InverseDiagonalBlock_ILUMatrix(unsigned long block_i, su2mixedfloat *invBlock);
   
   /*!
    * \brief Inverse a block.
    * \param[in] Block - block matrix.
    * \param[out] invBlock - Inverse block.
    */
-  void InverseBlock(su2double *Block, su2double *invBlock);
+  void InverseBlock(su2mixedfloat *Block, su2mixedfloat *invBlock);
   
   /*!
    * \brief Build the Jacobi preconditioner.
@@ -528,6 +729,21 @@ public:
    */
   void ComputeLineletPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Build the algebraic multigrid preconditioner, the aggregation and the sparse structure of
+   *        the coarse levels are computed by the first call and reused by the next ones.
+   */
+  void BuildAMGPreconditioner(void);
+  
+  /*!
+   * \brief Multiply CSysVector by the preconditioner (one V cycle of block aggregation AMG).
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product A*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeAMGPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config);
+  
   /*!
    * \brief Compute the residual Ax-b
    * \param[in] sol - CSysVector to be multiplied by the preconditioner.
@@ -769,4 +985,37 @@ public:
   void operator()(const CSysVector & u, CSysVector & v) const;
 };
 
+/*!
+ * \class CAMGPreconditioner
+ * \brief specialization of preconditioner that uses CSysMatrix class
+ */
+class CAMGPreconditioner : public CPreconditioner {
+private:
+  CSysMatrix* sparse_matrix; /*!< \brief pointer to matrix that defines the preconditioner. */
+  CGeometry* geometry; /*!< \brief pointer to matrix that defines the geometry. */
+  CConfig* config; /*!< \brief pointer to matrix that defines the config. */
+  
+public:
+  
+  /*!
+   * \brief constructor of the class
+   * \param[in] matrix_ref - matrix reference that will be used to define the preconditioner
+   * \param[in] geometry_ref -
+   * \param[in] config_ref -
+   */
+  CAMGPreconditioner(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref);
+  
+  /*!
+   * \brief destructor of the class
+   */
+  ~CAMGPreconditioner() {}
+  
+  /*!
+   * \brief operator that defines the preconditioner operation
+   * \param[in] u - CSysVector that is being preconditioned
+   * \param[out] v - CSysVector that is the result of the preconditioning
+   */
+  void operator()(const CSysVector & u, CSysVector & v) const;
+};
+
 #include "matrix_structure.inl"
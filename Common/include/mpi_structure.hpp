@@ -45,6 +45,7 @@
 
 #include "./datatype_structure.hpp"
 #include <stdlib.h>
+#include <vector>
 
 #ifdef HAVE_MPI
 
@@ -428,4 +429,33 @@ extern CBaseMPIWrapper::Status* MPI_STATUS_IGNORE;
 # define CURRENT_FUNCTION "(unknown)"
 #endif
 
+/*!
+ * \class CSumReduction
+ * \brief Accumulates local scalars and arrays whose global sums are required,
+ *        so that all of them are reduced with a single collective operation.
+ * \note The registered values are overwritten with their global sums by Reduce().
+ */
+class CSumReduction {
+private:
+  std::vector<su2double*> Data;        /*!< \brief Registered values. */
+  std::vector<unsigned long> Size;     /*!< \brief Number of entries of each registered value. */
+  std::vector<su2double> Send_Buffer;  /*!< \brief Packed local values. */
+  std::vector<su2double> Recv_Buffer;  /*!< \brief Packed global sums. */
+
+public:
+
+  /*!
+   * \brief Register a scalar or an array to be summed over all the ranks.
+   * \param[in,out] val_data - Local value(s), replaced by the global sum(s).
+   * \param[in] val_size - Number of entries of the array.
+   */
+  inline void Add(su2double *val_data, unsigned long val_size = 1);
+
+  /*!
+   * \brief Sum all the registered values over all the ranks with one Allreduce,
+   *        and clear the list of registered values.
+   */
+  void Reduce(void);
+};
+
 #include "mpi_structure.inl"
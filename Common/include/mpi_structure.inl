@@ -550,3 +550,9 @@ inline void CBaseMPIWrapper::CopyData(void *sendbuf, void *recvbuf, int size, Da
   }
 }
 #endif
+
+inline void CSumReduction::Add(su2double *val_data, unsigned long val_size) {
+  if (val_size == 0) return;
+  Data.push_back(val_data);
+  Size.push_back(val_size);
+}
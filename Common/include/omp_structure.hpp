@@ -0,0 +1,99 @@
+/*!
+ * \file omp_structure.hpp
+ * \brief Wrappers for the shared-memory (OpenMP) parallelization of the edge loops.
+ *        When the code is not compiled with OpenMP support (or when an AD type is
+ *        used, which is not thread-safe) the wrappers reduce to serial stubs.
+ * \version 6.0.1 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2018, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/*--- The hybrid MPI+threads mode is activated by compiling with the OpenMP flag of
+ the compiler (e.g. CXXFLAGS="-fopenmp"). The AD types are not thread-safe, hence
+ the threading is never used with them. ---*/
+
+#if defined(_OPENMP) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+#define HAVE_OMP
+#include <omp.h>
+#endif
+
+/*--- Convert the arguments into a pragma, e.g. SU2_OMP(parallel for) ---*/
+
+#define SU2_OMP_PRAGMA(ARGS) _Pragma(#ARGS)
+
+#ifdef HAVE_OMP
+#define SU2_OMP(ARGS) SU2_OMP_PRAGMA(omp ARGS)
+#else
+#define SU2_OMP(ARGS)
+#endif
+
+/*!
+ * \namespace OMP
+ * \brief Thread queries that fall back to a single thread in serial builds.
+ */
+namespace OMP {
+
+  /*!
+   * \brief Maximum number of threads that a parallel region may use.
+   */
+  inline int GetMaxThreads(void) {
+#ifdef HAVE_OMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+  }
+
+  /*!
+   * \brief Number of threads in the current parallel region.
+   */
+  inline int GetNumThreads(void) {
+#ifdef HAVE_OMP
+    return omp_get_num_threads();
+#else
+    return 1;
+#endif
+  }
+
+  /*!
+   * \brief Index of the calling thread in the current parallel region.
+   */
+  inline int GetThreadNum(void) {
+#ifdef HAVE_OMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+  }
+
+}
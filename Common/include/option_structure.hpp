@@ -1583,13 +1583,15 @@ enum ENUM_LINEAR_SOLVER_PREC {
   JACOBI = 1,		/*!< \brief Jacobi preconditioner. */
   LU_SGS = 2,		/*!< \brief LU SGS preconditioner. */
   LINELET = 3,  /*!< \brief Line implicit preconditioner. */
-  ILU = 4       /*!< \brief ILU(0) preconditioner. */
+  ILU = 4,      /*!< \brief ILU(0) preconditioner. */
+  AMG = 5       /*!< \brief Algebraic multigrid (block aggregation) preconditioner. */
 };
 static const map<string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Map = CCreateMap<string, ENUM_LINEAR_SOLVER_PREC>
 ("JACOBI", JACOBI)
 ("LU_SGS", LU_SGS)
 ("LINELET", LINELET)
-("ILU", ILU);
+("ILU", ILU)
+("AMG", AMG);
 
 /*!
  * \brief types of analytic definitions for various geometries
@@ -1718,6 +1720,22 @@ enum ENUM_RECORDING {
   ALL_VARIABLES = 8
 };
 
+/*!
+ * \brief Quantities exchanged between ranks in the point-to-point (halo) communications.
+ */
+enum ENUM_MPI_QUANTITIES {
+  COMM_SOLUTION = 0,              /*!< \brief Conservative solution. */
+  COMM_SOLUTION_OLD = 1,          /*!< \brief Solution at the previous iteration. */
+  COMM_SOLUTION_EDDY = 2,         /*!< \brief Turbulence solution and eddy viscosity. */
+  COMM_SOLUTION_GRADIENT = 3,     /*!< \brief Gradient of the solution. */
+  COMM_SOLUTION_LIMITER = 4,      /*!< \brief Limiter of the solution. */
+  COMM_PRIMITIVE_GRADIENT = 5,    /*!< \brief Gradient of the primitive variables. */
+  COMM_PRIMITIVE_LIMITER = 6,     /*!< \brief Limiter of the primitive variables. */
+  COMM_UNDIVIDED_LAPLACIAN = 7,   /*!< \brief Undivided Laplacian of the solution. */
+  COMM_SENSOR = 8,                /*!< \brief Pressure sensor of the centered schemes. */
+  COMM_MAX_EIGENVALUE = 9         /*!< \brief Spectral radius and number of neighbors. */
+};
+
 /*!
  * \brief types of schemes for dynamic structural computations
  */
@@ -410,6 +410,7 @@ void CConfig::SetPointersNull(void) {
 
   RefOriginMoment     = NULL;
   CFL_AdaptParam      = NULL;            
+  Newton_Krylov_Param = NULL;
   CFL                 = NULL;
   HTP_Axis = NULL;
   PlaneTag            = NULL;
@@ -461,6 +462,7 @@ void CConfig::SetPointersNull(void) {
   default_eng_cyl            = NULL;
   default_eng_val            = NULL;
   default_cfl_adapt          = NULL;
+  default_nk_param           = NULL;
   default_jst_coeff          = NULL;
   default_ffd_coeff          = NULL;
   default_mixedout_coeff     = NULL;
@@ -557,6 +559,7 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   default_eng_cyl            = new su2double[7];
   default_eng_val            = new su2double[5];
   default_cfl_adapt          = new su2double[4];
+  default_nk_param           = new su2double[2];
   default_jst_coeff          = new su2double[2];
   default_ffd_coeff          = new su2double[3];
   default_mixedout_coeff     = new su2double[3];
@@ -1026,6 +1029,13 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
    * and decrease when the residual is increasing or stalled. \ingroup Config*/
   default_cfl_adapt[0] = 0.0; default_cfl_adapt[1] = 0.0; default_cfl_adapt[2] = 1.0; default_cfl_adapt[3] = 100.0;
   addDoubleArrayOption("CFL_ADAPT_PARAM", 4, CFL_AdaptParam, default_cfl_adapt);
+  /* DESCRIPTION: Jacobian-free Newton-Krylov solution of the steady flow equations */
+  addBoolOption("NEWTON_KRYLOV", Newton_Krylov, false);
+  /* !\brief NEWTON_KRYLOV_PARAM
+   * DESCRIPTION: Parameters of the pseudo-transient continuation used with NEWTON_KRYLOV (exponent of the
+   * residual reduction applied to the CFL number, upper limit of the CFL number). \ingroup Config*/
+  default_nk_param[0] = 1.0; default_nk_param[1] = 1E4;
+  addDoubleArrayOption("NEWTON_KRYLOV_PARAM", 2, Newton_Krylov_Param, default_nk_param);
   /* DESCRIPTION: Reduction factor of the CFL coefficient in the adjoint problem */
   addDoubleOption("CFL_REDUCTION_ADJFLOW", CFLRedCoeff_AdjFlow, 0.8);
   /* DESCRIPTION: Reduction factor of the CFL coefficient in the level set problem */
@@ -1115,6 +1125,10 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addBoolOption("LOW_MACH_PREC", Low_Mach_Precon, false);
   /* DESCRIPTION: Post-reconstruction correction for low Mach number flows */
   addBoolOption("LOW_MACH_CORR", Low_Mach_Corr, false);
+  /* DESCRIPTION: Compute the convective fluxes of the flow in packs of edges */
+  addBoolOption("BATCHED_CONV_FLOW", Batched_Conv_Flow, true);
+  /* DESCRIPTION: Compute the viscous fluxes of the flow in packs of edges */
+  addBoolOption("BATCHED_VISC_FLOW", Batched_Visc_Flow, true);
   /* DESCRIPTION: Time Step for dual time stepping simulations (s) */
   addDoubleOption("MIN_ROE_TURKEL_PREC", Min_Beta_RoeTurkel, 0.01);
   /* DESCRIPTION: Time Step for dual time stepping simulations (s) */
@@ -6323,6 +6337,7 @@ CConfig::~CConfig(void) {
   if (default_eng_cyl       != NULL) delete [] default_eng_cyl;
   if (default_eng_val       != NULL) delete [] default_eng_val;
   if (default_cfl_adapt     != NULL) delete [] default_cfl_adapt;
+  if (default_nk_param      != NULL) delete [] default_nk_param;
   if (default_jst_coeff != NULL) delete [] default_jst_coeff;
   if (default_ffd_coeff != NULL) delete [] default_ffd_coeff;
   if (default_mixedout_coeff!= NULL) delete [] default_mixedout_coeff;
@@ -56,6 +56,10 @@ CPoint::CPoint(unsigned short val_nDim, unsigned long val_globalindex, CConfig *
   Coord   = NULL;  Coord_Old    = NULL;  Coord_Sum = NULL;
   Coord_n = NULL;  Coord_n1     = NULL;  Coord_p1 = NULL;
   GridVel = NULL;  GridVel_Grad = NULL;
+  Wall_Distance = NULL;
+
+  /*--- The arrays are owned by the point until they are relocated to the geometry ---*/
+  Shared_Storage = false;
 
   /*--- Volume (0 -> Vol_nP1, 1-> Vol_n, 2 -> Vol_nM1 ) and coordinates of the control volume ---*/
 
@@ -72,6 +76,9 @@ CPoint::CPoint(unsigned short val_nDim, unsigned long val_globalindex, CConfig *
 
   Coord = new su2double[nDim];
 
+  Wall_Distance = new su2double[1];
+  Wall_Distance[0] = 0.0;
+
   /*--- Indicator if the control volume has been agglomerated ---*/
   Parent_CV   = 0;
   Agglomerate = false;
@@ -147,6 +154,10 @@ CPoint::CPoint(su2double val_coord_0, su2double val_coord_1, unsigned long val_g
   Coord   = NULL;  Coord_Old    = NULL;  Coord_Sum = NULL;
   Coord_n = NULL;  Coord_n1     = NULL;  Coord_p1  = NULL;
   GridVel = NULL;  GridVel_Grad = NULL;
+  Wall_Distance = NULL;
+
+  /*--- The arrays are owned by the point until they are relocated to the geometry ---*/
+  Shared_Storage = false;
 
   /*--- Volume (0 -> Vol_nP1, 1-> Vol_n, 2 -> Vol_nM1 ) and coordinates of the control volume ---*/
 
@@ -165,6 +176,9 @@ CPoint::CPoint(su2double val_coord_0, su2double val_coord_1, unsigned long val_g
   Coord[0] = val_coord_0; 
   Coord[1] = val_coord_1;
 
+  Wall_Distance = new su2double[1];
+  Wall_Distance[0] = 0.0;
+
   /*--- Indicator if the control volume has been agglomerated ---*/
   Parent_CV   = 0;
   Agglomerate = false;
@@ -241,6 +255,10 @@ CPoint::CPoint(su2double val_coord_0, su2double val_coord_1, su2double val_coord
   Coord   = NULL;  Coord_Old    = NULL;  Coord_Sum = NULL;
   Coord_n = NULL;  Coord_n1     = NULL;  Coord_p1 = NULL;
   GridVel = NULL;  GridVel_Grad = NULL;
+  Wall_Distance = NULL;
+
+  /*--- The arrays are owned by the point until they are relocated to the geometry ---*/
+  Shared_Storage = false;
 
   /*--- Volume (0 -> Vol_nP1, 1-> Vol_n, 2 -> Vol_nM1 ) and coordinates of the control volume ---*/
   if ( config->GetUnsteady_Simulation() == NO ) { 
@@ -259,6 +277,9 @@ CPoint::CPoint(su2double val_coord_0, su2double val_coord_1, su2double val_coord
   Coord[1] = val_coord_1; 
   Coord[2] = val_coord_2;
 
+  Wall_Distance = new su2double[1];
+  Wall_Distance[0] = 0.0;
+
   /*--- Indicator if the control volume has been agglomerated ---*/
   Parent_CV = 0;
   Agglomerate = false;
@@ -327,8 +348,11 @@ CPoint::CPoint(su2double val_coord_0, su2double val_coord_1, su2double val_coord
 CPoint::~CPoint() {
 
   if (Vertex       != NULL && Boundary) delete[] Vertex;
-  if (Volume       != NULL) delete[] Volume;
-  if (Coord        != NULL) delete[] Coord;
+  if (!Shared_Storage) {
+    if (Volume        != NULL) delete[] Volume;
+    if (Coord         != NULL) delete[] Coord;
+    if (Wall_Distance != NULL) delete[] Wall_Distance;
+  }
   if (Coord_Old    != NULL) delete[] Coord_Old;
   if (Coord_Sum    != NULL) delete[] Coord_Sum;
   if (Coord_n      != NULL) delete[] Coord_n;
@@ -343,6 +367,34 @@ CPoint::~CPoint() {
   
 }
 
+void CPoint::SetStorage(su2double *val_coord, su2double *val_volume, unsigned short val_nvolume, su2double *val_wall_distance) {
+
+  unsigned short iDim, iVol;
+
+  /*--- Copy the current values into the external storage ---*/
+
+  for (iDim = 0; iDim < nDim; iDim++)
+    val_coord[iDim] = Coord[iDim];
+  for (iVol = 0; iVol < val_nvolume; iVol++)
+    val_volume[iVol] = Volume[iVol];
+  val_wall_distance[0] = Wall_Distance[0];
+
+  /*--- Release the arrays owned by the point and use the external ones ---*/
+
+  if (!Shared_Storage) {
+    delete [] Coord;
+    delete [] Volume;
+    delete [] Wall_Distance;
+  }
+
+  Coord         = val_coord;
+  Volume        = val_volume;
+  Wall_Distance = val_wall_distance;
+
+  Shared_Storage = true;
+
+}
+
 void CPoint::SetPoint(unsigned long val_point) {
 
   unsigned short iPoint;
@@ -404,16 +456,45 @@ CEdge::CEdge(unsigned long val_iPoint, unsigned long val_jPoint, unsigned short
   Nodes[0] = val_iPoint; 
   Nodes[1] = val_jPoint;
 
+  Shared_Storage = false;
+
 }
 
 CEdge::~CEdge() {
   
   if (Coord_CG != NULL) delete[] Coord_CG;
-  if (Normal   != NULL) delete[] Normal;
-  if (Nodes    != NULL) delete[] Nodes;
+  if (!Shared_Storage) {
+    if (Normal != NULL) delete[] Normal;
+    if (Nodes  != NULL) delete[] Nodes;
+  }
   
 }
 
+void CEdge::SetStorage(unsigned long *val_nodes, su2double *val_normal) {
+
+  unsigned short iDim;
+
+  /*--- Copy the current values into the external storage ---*/
+
+  val_nodes[0] = Nodes[0];
+  val_nodes[1] = Nodes[1];
+  for (iDim = 0; iDim < nDim; iDim++)
+    val_normal[iDim] = Normal[iDim];
+
+  /*--- Release the arrays owned by the edge and use the external ones ---*/
+
+  if (!Shared_Storage) {
+    delete [] Nodes;
+    delete [] Normal;
+  }
+
+  Nodes  = val_nodes;
+  Normal = val_normal;
+
+  Shared_Storage = true;
+
+}
+
 void CEdge::SetCoord_CG(su2double **val_coord) {
 
   unsigned short iDim, iNode;
@@ -104,6 +104,44 @@ CGeometry::CGeometry(void) {
   /*--- Containers for customized boundary conditions ---*/
   CustomBoundaryHeatFlux = NULL;      //Customized heat flux wall
   CustomBoundaryTemperature = NULL;   //Customized temperature wall
+
+  /*--- Contiguous dual grid storage ---*/
+  nVolume            = 1;
+  Point_Coord        = NULL;
+  Point_Volume       = NULL;
+  Point_WallDistance = NULL;
+  Edge_Nodes         = NULL;
+  Edge_Normal        = NULL;
+  Adjacency_Ptr      = NULL;
+  Adjacency_Ind      = NULL;
+  Adjacency_Edge     = NULL;
+  nEdgeColor         = 0;
+  EdgeColor_Ptr      = NULL;
+  EdgeColor_Edge     = NULL;
+
+  /*--- Point-to-point communications ---*/
+  P2PComms_Preprocessed = false;
+  nP2PSend          = 0;
+  nP2PRecv          = 0;
+  P2PSend_Rank      = NULL;
+  P2PRecv_Rank      = NULL;
+  P2PSend_Ptr       = NULL;
+  P2PRecv_Ptr       = NULL;
+  P2PSend_Point     = NULL;
+  P2PRecv_Point     = NULL;
+  P2PRecv_Rotation  = NULL;
+  P2P_RotMatrix     = NULL;
+  P2P_CountPerPoint = 0;
+  P2PSend_Buffer    = NULL;
+  P2PRecv_Buffer    = NULL;
+  P2PSend_Request   = NULL;
+  P2PRecv_Request   = NULL;
+  P2PSend_Status    = NULL;
+
+  LSQ_Weights_Updated = false;
+  LSQ_Weight_Ptr      = NULL;
+  LSQ_Weight          = NULL;
+  LSQ_Smatrix         = NULL;
   
 }
 
@@ -190,6 +228,35 @@ CGeometry::~CGeometry(void) {
     }
     delete [] CustomBoundaryTemperature;
   }
+
+  if (Point_Coord        != NULL) delete [] Point_Coord;
+  if (Point_Volume       != NULL) delete [] Point_Volume;
+  if (Point_WallDistance != NULL) delete [] Point_WallDistance;
+  if (Edge_Nodes         != NULL) delete [] Edge_Nodes;
+  if (Edge_Normal        != NULL) delete [] Edge_Normal;
+  if (Adjacency_Ptr      != NULL) delete [] Adjacency_Ptr;
+  if (Adjacency_Ind      != NULL) delete [] Adjacency_Ind;
+  if (Adjacency_Edge     != NULL) delete [] Adjacency_Edge;
+  if (EdgeColor_Ptr      != NULL) delete [] EdgeColor_Ptr;
+  if (EdgeColor_Edge     != NULL) delete [] EdgeColor_Edge;
+
+  if (P2PSend_Rank     != NULL) delete [] P2PSend_Rank;
+  if (P2PRecv_Rank     != NULL) delete [] P2PRecv_Rank;
+  if (P2PSend_Ptr      != NULL) delete [] P2PSend_Ptr;
+  if (P2PRecv_Ptr      != NULL) delete [] P2PRecv_Ptr;
+  if (P2PSend_Point    != NULL) delete [] P2PSend_Point;
+  if (P2PRecv_Point    != NULL) delete [] P2PRecv_Point;
+  if (P2PRecv_Rotation != NULL) delete [] P2PRecv_Rotation;
+  if (P2P_RotMatrix    != NULL) delete [] P2P_RotMatrix;
+  if (P2PSend_Buffer   != NULL) delete [] P2PSend_Buffer;
+  if (P2PRecv_Buffer   != NULL) delete [] P2PRecv_Buffer;
+  if (P2PSend_Request  != NULL) delete [] P2PSend_Request;
+  if (P2PRecv_Request  != NULL) delete [] P2PRecv_Request;
+  if (P2PSend_Status   != NULL) delete [] P2PSend_Status;
+
+  if (LSQ_Weight_Ptr != NULL) delete [] LSQ_Weight_Ptr;
+  if (LSQ_Weight     != NULL) delete [] LSQ_Weight;
+  if (LSQ_Smatrix    != NULL) delete [] LSQ_Smatrix;
   
 }
 
@@ -279,6 +346,434 @@ void CGeometry::SetEdges(void) {
     }
 }
 
+void CGeometry::SetDualGrid_Storage(CConfig *config) {
+
+  unsigned long iPoint, iEdge, iNeigh, nNeigh;
+  unsigned short iNode;
+
+  su2double *Coord_Old = Point_Coord, *Volume_Old = Point_Volume, *WallDistance_Old = Point_WallDistance,
+  *Normal_Old = Edge_Normal;
+  unsigned long *Nodes_Old = Edge_Nodes;
+
+  /*--- Volumes at n and n-1 are only stored for unsteady problems ---*/
+
+  nVolume = (config->GetUnsteady_Simulation() == NO)? 1 : 3;
+
+  /*--- Point data: the points copy their values and are pointed to the new arrays ---*/
+
+  Point_Coord        = new su2double[nPoint*nDim];
+  Point_Volume       = new su2double[nPoint*nVolume];
+  Point_WallDistance = new su2double[nPoint];
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    node[iPoint]->SetStorage(&Point_Coord[iPoint*nDim], &Point_Volume[iPoint*nVolume],
+                             nVolume, &Point_WallDistance[iPoint]);
+
+  /*--- Edge data ---*/
+
+  Edge_Nodes  = new unsigned long[nEdge*2];
+  Edge_Normal = new su2double[nEdge*nDim];
+
+  for (iEdge = 0; iEdge < nEdge; iEdge++)
+    edge[iEdge]->SetStorage(&Edge_Nodes[iEdge*2], &Edge_Normal[iEdge*nDim]);
+
+  /*--- The previous arrays (if any) are released once their content has been copied ---*/
+
+  if (Coord_Old        != NULL) delete [] Coord_Old;
+  if (Volume_Old       != NULL) delete [] Volume_Old;
+  if (WallDistance_Old != NULL) delete [] WallDistance_Old;
+  if (Nodes_Old        != NULL) delete [] Nodes_Old;
+  if (Normal_Old       != NULL) delete [] Normal_Old;
+
+  /*--- Point adjacency in CSR format, with the edge that connects each pair ---*/
+
+  if (Adjacency_Ptr  != NULL) delete [] Adjacency_Ptr;
+  if (Adjacency_Ind  != NULL) delete [] Adjacency_Ind;
+  if (Adjacency_Edge != NULL) delete [] Adjacency_Edge;
+
+  Adjacency_Ptr = new unsigned long[nPoint+1];
+  Adjacency_Ptr[0] = 0;
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    Adjacency_Ptr[iPoint+1] = Adjacency_Ptr[iPoint] + node[iPoint]->GetnPoint();
+
+  nNeigh = Adjacency_Ptr[nPoint];
+  Adjacency_Ind  = new unsigned long[nNeigh];
+  Adjacency_Edge = new unsigned long[nNeigh];
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (iNode = 0; iNode < node[iPoint]->GetnPoint(); iNode++) {
+      iNeigh = Adjacency_Ptr[iPoint] + iNode;
+      Adjacency_Ind[iNeigh]  = node[iPoint]->GetPoint(iNode);
+      Adjacency_Edge[iNeigh] = node[iPoint]->GetEdge(iNode);
+    }
+  }
+
+}
+
+void CGeometry::SetEdge_Coloring(unsigned short val_nthread) {
+
+  unsigned long iPoint, jPoint, iEdge, nColored;
+  unsigned short iColor;
+
+  if (EdgeColor_Ptr  != NULL) delete [] EdgeColor_Ptr;
+  if (EdgeColor_Edge != NULL) delete [] EdgeColor_Edge;
+
+  EdgeColor_Edge = new unsigned long[nEdge];
+
+  /*--- Serial edge loops use a single color with the natural edge ordering ---*/
+
+  if (val_nthread <= 1) {
+    nEdgeColor = 1;
+    EdgeColor_Ptr = new unsigned long[2];
+    EdgeColor_Ptr[0] = 0; EdgeColor_Ptr[1] = nEdge;
+    for (iEdge = 0; iEdge < nEdge; iEdge++)
+      EdgeColor_Edge[iEdge] = iEdge;
+    return;
+  }
+
+  /*--- Greedy coloring, each sweep over the edges fills one color with all
+   the remaining edges whose points have not been used by that color yet.
+   The number of colors is bounded by twice the maximum number of neighbors. ---*/
+
+  long *Point_Color = new long[nPoint];
+  long *Edge_Color = new long[nEdge];
+  vector<unsigned long> Color_Size;
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) Point_Color[iPoint] = -1;
+  for (iEdge = 0; iEdge < nEdge; iEdge++) Edge_Color[iEdge] = -1;
+
+  nColored = 0; iColor = 0;
+  while (nColored < nEdge) {
+    Color_Size.push_back(0);
+    for (iEdge = 0; iEdge < nEdge; iEdge++) {
+      if (Edge_Color[iEdge] != -1) continue;
+      iPoint = edge[iEdge]->GetNode(0); jPoint = edge[iEdge]->GetNode(1);
+      if ((Point_Color[iPoint] != iColor) && (Point_Color[jPoint] != iColor)) {
+        Edge_Color[iEdge] = iColor;
+        Point_Color[iPoint] = iColor; Point_Color[jPoint] = iColor;
+        Color_Size[iColor]++; nColored++;
+      }
+    }
+    iColor++;
+  }
+  nEdgeColor = iColor;
+
+  /*--- Sort the edges by color, keeping the natural order within each color ---*/
+
+  EdgeColor_Ptr = new unsigned long[nEdgeColor+1];
+  EdgeColor_Ptr[0] = 0;
+  for (iColor = 0; iColor < nEdgeColor; iColor++)
+    EdgeColor_Ptr[iColor+1] = EdgeColor_Ptr[iColor] + Color_Size[iColor];
+
+  for (iColor = 0; iColor < nEdgeColor; iColor++) Color_Size[iColor] = 0;
+  for (iEdge = 0; iEdge < nEdge; iEdge++) {
+    iColor = Edge_Color[iEdge];
+    EdgeColor_Edge[EdgeColor_Ptr[iColor] + Color_Size[iColor]] = iEdge;
+    Color_Size[iColor]++;
+  }
+
+  delete [] Point_Color;
+  delete [] Edge_Color;
+
+}
+
+void CGeometry::PreprocessP2PComms(CConfig *config) {
+
+  unsigned short iMarker, MarkerS, MarkerR, iPeriodic, nPeriodic;
+  unsigned long iVertex, nSend, nRecv;
+  su2double *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi, *rotMatrix;
+
+  /*--- Count the messages and the points, each SEND_RECEIVE marker pair
+   (send marker followed by its receive marker) is one message. ---*/
+
+  nP2PSend = 0; nP2PRecv = 0; nSend = 0; nRecv = 0;
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
+        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
+      MarkerS = iMarker;  MarkerR = iMarker+1;
+      nP2PSend++; nSend += nVertex[MarkerS];
+      nP2PRecv++; nRecv += nVertex[MarkerR];
+    }
+  }
+
+  if (P2PSend_Rank     != NULL) delete [] P2PSend_Rank;
+  if (P2PRecv_Rank     != NULL) delete [] P2PRecv_Rank;
+  if (P2PSend_Ptr      != NULL) delete [] P2PSend_Ptr;
+  if (P2PRecv_Ptr      != NULL) delete [] P2PRecv_Ptr;
+  if (P2PSend_Point    != NULL) delete [] P2PSend_Point;
+  if (P2PRecv_Point    != NULL) delete [] P2PRecv_Point;
+  if (P2PRecv_Rotation != NULL) delete [] P2PRecv_Rotation;
+  if (P2P_RotMatrix    != NULL) delete [] P2P_RotMatrix;
+  if (P2PSend_Request  != NULL) delete [] P2PSend_Request;
+  if (P2PRecv_Request  != NULL) delete [] P2PRecv_Request;
+  if (P2PSend_Status   != NULL) delete [] P2PSend_Status;
+
+  P2PSend_Rank     = new int[nP2PSend];
+  P2PRecv_Rank     = new int[nP2PRecv];
+  P2PSend_Ptr      = new unsigned long[nP2PSend+1];
+  P2PRecv_Ptr      = new unsigned long[nP2PRecv+1];
+  P2PSend_Point    = new unsigned long[nSend];
+  P2PRecv_Point    = new unsigned long[nRecv];
+  P2PRecv_Rotation = new unsigned short[nRecv];
+  P2PSend_Request  = new SU2_MPI::Request[nP2PSend];
+  P2PRecv_Request  = new SU2_MPI::Request[nP2PRecv];
+  P2PSend_Status   = new SU2_MPI::Status[nP2PSend];
+
+  /*--- Store the points of the messages, in the order of the vertices of the markers. ---*/
+
+  nP2PSend = 0; nP2PRecv = 0;
+  P2PSend_Ptr[0] = 0; P2PRecv_Ptr[0] = 0;
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
+        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
+
+      MarkerS = iMarker;  MarkerR = iMarker+1;
+
+      P2PSend_Rank[nP2PSend] = config->GetMarker_All_SendRecv(MarkerS)-1;
+      P2PRecv_Rank[nP2PRecv] = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
+
+      nSend = P2PSend_Ptr[nP2PSend];
+      for (iVertex = 0; iVertex < nVertex[MarkerS]; iVertex++)
+        P2PSend_Point[nSend+iVertex] = vertex[MarkerS][iVertex]->GetNode();
+      P2PSend_Ptr[nP2PSend+1] = nSend + nVertex[MarkerS];
+
+      nRecv = P2PRecv_Ptr[nP2PRecv];
+      for (iVertex = 0; iVertex < nVertex[MarkerR]; iVertex++) {
+        P2PRecv_Point[nRecv+iVertex] = vertex[MarkerR][iVertex]->GetNode();
+        P2PRecv_Rotation[nRecv+iVertex] = vertex[MarkerR][iVertex]->GetRotation_Type();
+      }
+      P2PRecv_Ptr[nP2PRecv+1] = nRecv + nVertex[MarkerR];
+
+      nP2PSend++; nP2PRecv++;
+    }
+  }
+
+  /*--- Rotation matrix of each periodic transformation. Note that the implicit
+   ordering is rotation about the x-axis, y-axis, then z-axis. Note that this
+   is the transpose of the matrix used during the preprocessing stage. ---*/
+
+  nPeriodic = config->GetnPeriodicIndex();
+  P2P_RotMatrix = new su2double[9*max(nPeriodic, (unsigned short)1)];
+  for (iPeriodic = 0; iPeriodic < 9*max(nPeriodic, (unsigned short)1); iPeriodic++)
+    P2P_RotMatrix[iPeriodic] = 0.0;
+  P2P_RotMatrix[0] = 1.0; P2P_RotMatrix[4] = 1.0; P2P_RotMatrix[8] = 1.0;
+
+  for (iPeriodic = 0; iPeriodic < nPeriodic; iPeriodic++) {
+
+    angles = config->GetPeriodicRotation(iPeriodic);
+    rotMatrix = &P2P_RotMatrix[iPeriodic*9];
+
+    theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
+    cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
+    sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
+
+    rotMatrix[0] = cosPhi*cosPsi;    rotMatrix[3] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[6] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
+    rotMatrix[1] = cosPhi*sinPsi;    rotMatrix[4] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[7] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
+    rotMatrix[2] = -sinPhi;          rotMatrix[5] = sinTheta*cosPhi;                              rotMatrix[8] = cosTheta*cosPhi;
+
+  }
+
+  P2PComms_Preprocessed = true;
+
+}
+
+void CGeometry::AllocateP2PComms(unsigned short val_countPerPoint) {
+
+  if (val_countPerPoint <= P2P_CountPerPoint) return;
+
+  if (P2PSend_Buffer != NULL) delete [] P2PSend_Buffer;
+  if (P2PRecv_Buffer != NULL) delete [] P2PRecv_Buffer;
+
+  P2P_CountPerPoint = val_countPerPoint;
+  P2PSend_Buffer = new su2double[P2PSend_Ptr[nP2PSend]*P2P_CountPerPoint];
+  P2PRecv_Buffer = new su2double[P2PRecv_Ptr[nP2PRecv]*P2P_CountPerPoint];
+
+}
+
+void CGeometry::PostP2PRecvs(unsigned short val_countPerPoint) {
+
+#ifdef HAVE_MPI
+
+  int iMessage, count;
+
+  /*--- Several messages between the same pair of ranks (e.g. periodic markers)
+   are matched in the order in which they are posted, which is the marker order
+   on both sides, as with the blocking exchange. ---*/
+
+  for (iMessage = 0; iMessage < nP2PRecv; iMessage++) {
+    count = (P2PRecv_Ptr[iMessage+1]-P2PRecv_Ptr[iMessage])*val_countPerPoint;
+    SU2_MPI::Irecv(&P2PRecv_Buffer[P2PRecv_Ptr[iMessage]*val_countPerPoint], count, MPI_DOUBLE,
+                   P2PRecv_Rank[iMessage], 0, MPI_COMM_WORLD, &P2PRecv_Request[iMessage]);
+  }
+
+#endif
+
+}
+
+void CGeometry::PostP2PSends(unsigned short val_countPerPoint) {
+
+  int iMessage;
+
+#ifdef HAVE_MPI
+
+  int count;
+
+  for (iMessage = 0; iMessage < nP2PSend; iMessage++) {
+    count = (P2PSend_Ptr[iMessage+1]-P2PSend_Ptr[iMessage])*val_countPerPoint;
+    SU2_MPI::Isend(&P2PSend_Buffer[P2PSend_Ptr[iMessage]*val_countPerPoint], count, MPI_DOUBLE,
+                   P2PSend_Rank[iMessage], 0, MPI_COMM_WORLD, &P2PSend_Request[iMessage]);
+  }
+
+#else
+
+  /*--- Without MPI the messages are periodic, the send and receive markers
+   of a pair have the same vertices. ---*/
+
+  unsigned long iVal, nVal;
+  su2double *bufSend, *bufRecv;
+
+  for (iMessage = 0; iMessage < nP2PRecv; iMessage++) {
+    nVal = (P2PRecv_Ptr[iMessage+1]-P2PRecv_Ptr[iMessage])*val_countPerPoint;
+    bufSend = &P2PSend_Buffer[P2PSend_Ptr[iMessage]*val_countPerPoint];
+    bufRecv = &P2PRecv_Buffer[P2PRecv_Ptr[iMessage]*val_countPerPoint];
+    for (iVal = 0; iVal < nVal; iVal++)
+      bufRecv[iVal] = bufSend[iVal];
+  }
+
+#endif
+
+}
+
+int CGeometry::WaitAnyP2PRecv(int val_iMessage) {
+
+#ifdef HAVE_MPI
+  int iMessage;
+  SU2_MPI::Status status;
+  SU2_MPI::Waitany(nP2PRecv, P2PRecv_Request, &iMessage, &status);
+  return iMessage;
+#else
+  return val_iMessage;
+#endif
+
+}
+
+void CGeometry::WaitAllP2PSends(void) {
+
+#ifdef HAVE_MPI
+  SU2_MPI::Waitall(nP2PSend, P2PSend_Request, P2PSend_Status);
+#endif
+
+}
+
+void CGeometry::SetLeastSquares_Weights(void) {
+
+  unsigned short iDim, iNeigh;
+  unsigned long iPoint, jPoint, iEntry;
+  su2double *Coord_i, *Coord_j, *Weight, *Smatrix, r11, r12, r13, r22, r23, r23_a, r23_b, r33,
+  weight, detR2, z11, z12, z13, z22, z23, z33;
+
+  if (LSQ_Weights_Updated) return;
+
+  /*--- The neighbor lists do not change, the offsets are built only once ---*/
+
+  if (LSQ_Weight_Ptr == NULL) {
+    LSQ_Weight_Ptr = new unsigned long [nPoint+1];
+    LSQ_Weight_Ptr[0] = 0;
+    for (iPoint = 0; iPoint < nPoint; iPoint++)
+      LSQ_Weight_Ptr[iPoint+1] = LSQ_Weight_Ptr[iPoint] + node[iPoint]->GetnPoint();
+    LSQ_Weight  = new su2double [LSQ_Weight_Ptr[nPoint]*(nDim+1)];
+    LSQ_Smatrix = new su2double [nPoint*nDim*nDim];
+  }
+
+  for (iEntry = 0; iEntry < LSQ_Weight_Ptr[nPoint]*(nDim+1); iEntry++) LSQ_Weight[iEntry] = 0.0;
+  for (iEntry = 0; iEntry < nPoint*nDim*nDim; iEntry++) LSQ_Smatrix[iEntry] = 0.0;
+
+  /*--- The operations are the ones of CSolver::SetSolution_Gradient_LS, so that
+   the gradients computed with the stored data are identical ---*/
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+    Coord_i = node[iPoint]->GetCoord();
+
+    r11 = 0.0; r12 = 0.0; r13 = 0.0; r22 = 0.0;
+    r23 = 0.0; r23_a = 0.0; r23_b = 0.0; r33 = 0.0;
+
+    for (iNeigh = 0; iNeigh < node[iPoint]->GetnPoint(); iNeigh++) {
+      jPoint = node[iPoint]->GetPoint(iNeigh);
+      Coord_j = node[jPoint]->GetCoord();
+      Weight = &LSQ_Weight[(LSQ_Weight_Ptr[iPoint]+iNeigh)*(nDim+1)];
+
+      weight = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Weight[iDim] = Coord_j[iDim]-Coord_i[iDim];
+        weight += (Coord_j[iDim]-Coord_i[iDim])*(Coord_j[iDim]-Coord_i[iDim]);
+      }
+      Weight[nDim] = weight;
+
+      /*--- Sumations for entries of upper triangular matrix R ---*/
+
+      if (weight != 0.0) {
+        r11 += (Coord_j[0]-Coord_i[0])*(Coord_j[0]-Coord_i[0])/weight;
+        r12 += (Coord_j[0]-Coord_i[0])*(Coord_j[1]-Coord_i[1])/weight;
+        r22 += (Coord_j[1]-Coord_i[1])*(Coord_j[1]-Coord_i[1])/weight;
+        if (nDim == 3) {
+          r13   += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
+          r23_a += (Coord_j[1]-Coord_i[1])*(Coord_j[2]-Coord_i[2])/weight;
+          r23_b += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
+          r33   += (Coord_j[2]-Coord_i[2])*(Coord_j[2]-Coord_i[2])/weight;
+        }
+      }
+    }
+
+    /*--- Entries of upper triangular matrix R ---*/
+
+    if (r11 >= 0.0) r11 = sqrt(r11); else r11 = 0.0;
+    if (r11 != 0.0) r12 = r12/r11; else r12 = 0.0;
+    if (r22-r12*r12 >= 0.0) r22 = sqrt(r22-r12*r12); else r22 = 0.0;
+
+    if (nDim == 3) {
+      if (r11 != 0.0) r13 = r13/r11; else r13 = 0.0;
+      if ((r22 != 0.0) && (r11*r22 != 0.0)) r23 = r23_a/r22 - r23_b*r12/(r11*r22); else r23 = 0.0;
+      if (r33-r23*r23-r13*r13 >= 0.0) r33 = sqrt(r33-r23*r23-r13*r13); else r33 = 0.0;
+    }
+
+    if (nDim == 2) detR2 = (r11*r22)*(r11*r22);
+    else detR2 = (r11*r22*r33)*(r11*r22*r33);
+
+    /*--- Singular matrices keep S = 0, i.e. a zero gradient ---*/
+
+    if (abs(detR2) <= EPS) continue;
+
+    /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
+
+    Smatrix = &LSQ_Smatrix[iPoint*nDim*nDim];
+
+    if (nDim == 2) {
+      Smatrix[0] = (r12*r12+r22*r22)/detR2;
+      Smatrix[1] = -r11*r12/detR2;
+      Smatrix[2] = Smatrix[1];
+      Smatrix[3] = r11*r11/detR2;
+    }
+    else {
+      z11 = r22*r33; z12 = -r12*r33; z13 = r12*r23-r13*r22;
+      z22 = r11*r33; z23 = -r11*r23; z33 = r11*r22;
+      Smatrix[0] = (z11*z11+z12*z12+z13*z13)/detR2;
+      Smatrix[1] = (z12*z22+z13*z23)/detR2;
+      Smatrix[2] = (z13*z33)/detR2;
+      Smatrix[3] = Smatrix[1];
+      Smatrix[4] = (z22*z22+z23*z23)/detR2;
+      Smatrix[5] = (z23*z33)/detR2;
+      Smatrix[6] = Smatrix[2];
+      Smatrix[7] = Smatrix[5];
+      Smatrix[8] = (z33*z33)/detR2;
+    }
+
+  }
+
+  LSQ_Weights_Updated = true;
+
+}
+
 void CGeometry::SetFaces(void) {
   //	unsigned long iPoint, jPoint, iFace;
   //	unsigned short jNode, iNode;
@@ -12823,6 +13318,10 @@ void CPhysicalGeometry::SetControlVolume(CConfig *config, unsigned short action)
   Volume, DomainVolume, my_DomainVolume, *NormalFace = NULL;
   bool change_face_orientation;
 
+  /*--- The least-squares gradient weights depend on the coordinates, mark them as outdated ---*/
+
+  LSQ_Weights_Updated = false;
+
   /*--- Update values of faces of the edge ---*/
   if (action != ALLOCATE) {
     for (iEdge = 0; iEdge < (long)nEdge; iEdge++)
@@ -18162,6 +18661,9 @@ void CMultiGridGeometry::SetControlVolume(CConfig *config, CGeometry *fine_grid,
   su2double *Normal, Coarse_Volume, Area, *NormalFace = NULL;
   Normal = new su2double [nDim];
   
+  /*--- The least-squares gradient weights depend on the coordinates, mark them as outdated ---*/
+  LSQ_Weights_Updated = false;
+  
   /*--- Compute the area of the coarse volume ---*/
   for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++) {
     node[iCoarsePoint]->SetVolume(0.0);
@@ -223,13 +223,20 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     		mat_vec = new CSysMatrixVectorProduct(StiffMatrix, geometry, config);
     		precond = new CJacobiPreconditioner(StiffMatrix, geometry, config);
     	}
+    	if (config->GetKind_Deform_Linear_Solver_Prec() == AMG) {
+        if ((rank == MASTER_NODE) && Screen_Output) cout << "\n# AMG preconditioner." << endl;
+    		StiffMatrix.BuildAMGPreconditioner();
+    		mat_vec = new CSysMatrixVectorProduct(StiffMatrix, geometry, config);
+    		precond = new CAMGPreconditioner(StiffMatrix, geometry, config);
+    	}
 
     } else if (Derivative && (config->GetKind_SU2() == SU2_DOT)) {
 
     	/*--- Build the ILU or Jacobi preconditioner for the transposed system ---*/
 
     	if ((config->GetKind_Deform_Linear_Solver_Prec() == ILU) ||
-    			(config->GetKind_Deform_Linear_Solver_Prec() == LU_SGS)) {
+    			(config->GetKind_Deform_Linear_Solver_Prec() == LU_SGS) ||
+    			(config->GetKind_Deform_Linear_Solver_Prec() == AMG)) {
         if ((rank == MASTER_NODE) && Screen_Output) cout << "\n# ILU preconditioner." << endl;
     		StiffMatrix.BuildILUPreconditioner(true);
     		mat_vec = new CSysMatrixVectorProductTransposed(StiffMatrix, geometry, config);
@@ -9563,6 +9570,10 @@ void CElasticityMovement::Solve_System(CGeometry *geometry, CConfig *config){
       StiffMatrix.BuildJacobiPreconditioner();
       precond = new CLineletPreconditioner(StiffMatrix, geometry, config);
       break;
+    case AMG:
+      StiffMatrix.BuildAMGPreconditioner();
+      precond = new CAMGPreconditioner(StiffMatrix, geometry, config);
+      break;
     default:
       StiffMatrix.BuildJacobiPreconditioner();
       precond = new CJacobiPreconditioner(StiffMatrix, geometry, config);
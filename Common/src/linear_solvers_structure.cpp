@@ -636,6 +636,10 @@ unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CS
         Jacobian.BuildJacobiPreconditioner();
         precond = new CLineletPreconditioner(Jacobian, geometry, config);
         break;
+      case AMG:
+        Jacobian.BuildAMGPreconditioner();
+        precond = new CAMGPreconditioner(Jacobian, geometry, config);
+        break;
       default:
         Jacobian.BuildJacobiPreconditioner();
         precond = new CJacobiPreconditioner(Jacobian, geometry, config);
@@ -76,6 +76,47 @@ CSysMatrix::CSysMatrix(void) {
   FzVector        = NULL;
   max_nElem       = 0;
   
+  /*--- Block positions ---*/
+  
+  dia_ptr  = NULL;
+  nEdge    = 0;
+  edge_ptr = NULL;
+  
+  /*--- Matrix-vector product and halo exchange ---*/
+  
+  nRow_Send        = 0;
+  Row_Order        = NULL;
+  Halo_Buffer_Send = NULL;
+  Halo_Buffer_Recv = NULL;
+  Halo_Request     = NULL;
+  nHalo_Request    = 0;
+  
+  /*--- Dense block kernels ---*/
+  
+  Block_MatVec  = NULL;
+  Block_MatMat  = NULL;
+  Block_Solve   = NULL;
+  Block_Inverse = NULL;
+  
+  /*--- Algebraic multigrid preconditioner ---*/
+  
+  nAMG_Level      = 0;
+  AMG_nSweep      = 1;
+  AMG_nBlk        = NULL;
+  AMG_nnz         = NULL;
+  AMG_row_ptr     = NULL;
+  AMG_col_ind     = NULL;
+  AMG_dia_ptr     = NULL;
+  AMG_Parent      = NULL;
+  AMG_Galerkin    = NULL;
+  AMG_matrix      = NULL;
+  AMG_invDiag     = NULL;
+  AMG_Rhs         = NULL;
+  AMG_Sol         = NULL;
+  AMG_Res         = NULL;
+  AMG_Coarse_LU   = NULL;
+  AMG_Coarse_Perm = NULL;
+  
 }
 
 CSysMatrix::~CSysMatrix(void) {
@@ -125,6 +166,44 @@ CSysMatrix::~CSysMatrix(void) {
   if (LyVector != NULL)   delete [] LyVector;
   if (FzVector != NULL)   delete [] FzVector;
   
+  if (dia_ptr != NULL)          delete [] dia_ptr;
+  if (edge_ptr != NULL)         delete [] edge_ptr;
+  if (Row_Order != NULL)        delete [] Row_Order;
+  if (Halo_Buffer_Send != NULL) delete [] Halo_Buffer_Send;
+  if (Halo_Buffer_Recv != NULL) delete [] Halo_Buffer_Recv;
+  if (Halo_Request != NULL)     delete [] Halo_Request;
+  
+  /*--- The first level of the AMG hierarchy shares the structure and entries of the matrix ---*/
+  
+  for (unsigned short iLevel = 0; iLevel < nAMG_Level; iLevel++) {
+    if (iLevel > 0) {
+      delete [] AMG_row_ptr[iLevel];
+      delete [] AMG_col_ind[iLevel];
+      delete [] AMG_matrix[iLevel];
+    }
+    delete [] AMG_dia_ptr[iLevel];
+    delete [] AMG_invDiag[iLevel];
+    delete [] AMG_Rhs[iLevel];
+    delete [] AMG_Sol[iLevel];
+    delete [] AMG_Res[iLevel];
+    if (AMG_Parent[iLevel] != NULL)   delete [] AMG_Parent[iLevel];
+    if (AMG_Galerkin[iLevel] != NULL) delete [] AMG_Galerkin[iLevel];
+  }
+  if (AMG_nBlk != NULL)        delete [] AMG_nBlk;
+  if (AMG_nnz != NULL)         delete [] AMG_nnz;
+  if (AMG_row_ptr != NULL)     delete [] AMG_row_ptr;
+  if (AMG_col_ind != NULL)     delete [] AMG_col_ind;
+  if (AMG_dia_ptr != NULL)     delete [] AMG_dia_ptr;
+  if (AMG_Parent != NULL)      delete [] AMG_Parent;
+  if (AMG_Galerkin != NULL)    delete [] AMG_Galerkin;
+  if (AMG_matrix != NULL)      delete [] AMG_matrix;
+  if (AMG_invDiag != NULL)     delete [] AMG_invDiag;
+  if (AMG_Rhs != NULL)         delete [] AMG_Rhs;
+  if (AMG_Sol != NULL)         delete [] AMG_Sol;
+  if (AMG_Res != NULL)         delete [] AMG_Res;
+  if (AMG_Coarse_LU != NULL)   delete [] AMG_Coarse_LU;
+  if (AMG_Coarse_Perm != NULL) delete [] AMG_Coarse_Perm;
+  
 }
 
 void CSysMatrix::Initialize(unsigned long nPoint, unsigned long nPointDomain,
@@ -213,6 +292,10 @@ void CSysMatrix::Initialize(unsigned long nPoint, unsigned long nPointDomain,
   
   SetIndexes(nPoint, nPointDomain, nVar, nEqn, row_ptr, col_ind, nnz, config);
   
+  /*--- Direct access to the diagonal blocks and to the blocks of the edges ---*/
+  
+  SetBlock_Positions(geometry, EdgeConnect);
+  
   /*--- Initialization matrix to zero ---*/
   
   SetValZero();
@@ -260,7 +343,7 @@ void CSysMatrix::Initialize(unsigned long nPoint, unsigned long nPointDomain,
       
     }
     
-    ILU_matrix = new su2double [nnz_ilu*nVar*nEqn];
+    ILU_matrix = new su2mixedfloat [nnz_ilu*nVar*nEqn];
     for (iVar = 0; iVar < nnz_ilu*nVar*nEqn; iVar++) ILU_matrix[iVar] = 0.0;
     
     delete [] nNeigh_ilu;
@@ -296,6 +379,52 @@ void CSysMatrix::SetNeighbours(CGeometry *geometry, unsigned long iPoint, unsign
   
 }
 
+void CSysMatrix::SetBlock_Positions(CGeometry *geometry, bool EdgeConnect) {
+  
+  unsigned long iPoint, jPoint, iEdge, *diagonal;
+  
+  if (dia_ptr != NULL) delete [] dia_ptr;
+  if (edge_ptr != NULL) delete [] edge_ptr;
+  dia_ptr = NULL;  edge_ptr = NULL;  nEdge = 0;
+  
+  /*--- Diagonal block of each row (found by search while dia_ptr is not set) ---*/
+  
+  diagonal = new unsigned long [nPoint];
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    diagonal[iPoint] = GetBlock_Position(iPoint, iPoint);
+  dia_ptr = diagonal;
+  
+  /*--- Blocks ii, ij, ji and jj of each edge, which are the ones updated by
+   the edge loops of the finite volume solvers ---*/
+  
+  if (EdgeConnect) {
+    nEdge = geometry->GetnEdge();
+    edge_ptr = new unsigned long [4*nEdge];
+    for (iEdge = 0; iEdge < nEdge; iEdge++) {
+      iPoint = geometry->edge[iEdge]->GetNode(0);
+      jPoint = geometry->edge[iEdge]->GetNode(1);
+      edge_ptr[4*iEdge  ] = dia_ptr[iPoint];
+      edge_ptr[4*iEdge+1] = GetBlock_Position(iPoint, jPoint);
+      edge_ptr[4*iEdge+2] = GetBlock_Position(jPoint, iPoint);
+      edge_ptr[4*iEdge+3] = dia_ptr[jPoint];
+    }
+  }
+  
+}
+
+unsigned long CSysMatrix::GetBlock_Position(unsigned long block_i, unsigned long block_j) const {
+  
+  unsigned long index;
+  
+  if ((block_i == block_j) && (dia_ptr != NULL)) return dia_ptr[block_i];
+  
+  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++)
+    if (col_ind[index] == block_j) return index;
+  
+  return nnz;
+  
+}
+
 void CSysMatrix::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDomain, unsigned short val_nVar, unsigned short val_nEq, unsigned long* val_row_ptr, unsigned long* val_col_ind, unsigned long val_nnz, CConfig *config) {
   
   unsigned long iVar;
@@ -315,10 +444,10 @@ void CSysMatrix::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDo
     nnz_ilu      = val_nnz;           // Assign number of possible non zero blocks in the spare system structure (ILU structure)
   }
   
-  matrix            = new su2double [nnz*nVar*nEqn];  // Reserve memory for the values of the matrix
-  block             = new su2double [nVar*nEqn];
-  block_weight      = new su2double [nVar*nEqn];
-  block_inverse     = new su2double [nVar*nEqn];
+  matrix            = new su2mixedfloat [nnz*nVar*nEqn];  // Reserve memory for the values of the matrix
+  block             = new su2mixedfloat [nVar*nEqn];
+  block_weight      = new su2mixedfloat [nVar*nEqn];
+  block_inverse     = new su2mixedfloat [nVar*nEqn];
 
   prod_block_vector = new su2double [nEqn];
   prod_row_vector   = new su2double [nVar];
@@ -350,7 +479,7 @@ void CSysMatrix::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDo
       
       /*--- Reserve memory for the ILU matrix. ---*/
       
-      ILU_matrix = new su2double [nnz_ilu*nVar*nEqn];
+      ILU_matrix = new su2mixedfloat [nnz_ilu*nVar*nEqn];
       for (iVar = 0; iVar < nnz_ilu*nVar*nEqn; iVar++) ILU_matrix[iVar] = 0.0;
       
     }
@@ -370,106 +499,348 @@ void CSysMatrix::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDo
     
     /*--- Reserve memory for the values of the inverse of the preconditioner. ---*/
     
-    invM = new su2double [nPoint*nVar*nEqn];
+    invM = new su2mixedfloat [nPoint*nVar*nEqn];
     for (iVar = 0; iVar < nPoint*nVar*nEqn; iVar++) invM[iVar] = 0.0;
 
   }
+  
+  /*--- Dense block kernels for this block size ---*/
+  
+  SetBlock_Kernels();
 
 }
 
-su2double *CSysMatrix::GetBlock(unsigned long block_i, unsigned long block_j) {
+template<unsigned short nBlk>
+void CSysMatrix::BlockKernel_MatVec(unsigned short val_n, const su2mixedfloat *a, const su2double *b, su2double *c) {
   
-  unsigned long step = 0, index;
+  const unsigned short n = (nBlk > 0)? nBlk : val_n;
+  unsigned short iVar, jVar;
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
-    step++;
-    if (col_ind[index] == block_j) { return &(matrix[(row_ptr[block_i]+step-1)*nVar*nEqn]); }
+  for (iVar = 0; iVar < n; iVar++) {
+    c[iVar] = 0.0;
+    for (jVar = 0; jVar < n; jVar++)
+      c[iVar] += a[iVar*n+jVar] * b[jVar];
   }
-  return NULL;
   
 }
 
-su2double CSysMatrix::GetBlock(unsigned long block_i, unsigned long block_j, unsigned short iVar, unsigned short jVar) {
+template<unsigned short nBlk>
+void CSysMatrix::BlockKernel_MatMat(unsigned short val_n, const su2mixedfloat *a, const su2mixedfloat *b, su2mixedfloat *c) {
   
-  unsigned long step = 0, index;
+  const unsigned short n = (nBlk > 0)? nBlk : val_n;
+  unsigned short iVar, jVar, kVar;
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
-    step++;
-    if (col_ind[index] == block_j) { return matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar]; }
+  for (iVar = 0; iVar < n; iVar++) {
+    for (jVar = 0; jVar < n; jVar++) {
+      c[iVar*n+jVar] = 0.0;
+      for (kVar = 0; kVar < n; kVar++)
+        c[iVar*n+jVar] += a[iVar*n+kVar] * b[kVar*n+jVar];
+    }
   }
-  return 0;
   
 }
 
-void CSysMatrix::SetBlock(unsigned long block_i, unsigned long block_j, su2double **val_block) {
+template<unsigned short nBlk>
+void CSysMatrix::BlockKernel_Solve(unsigned short val_n, const su2mixedfloat *Block, su2double *rhs, su2mixedfloat *work) {
   
-  unsigned long iVar, jVar, index, step = 0;
+  const short n = (nBlk > 0)? nBlk : val_n;
+  short iVar, jVar, kVar;
+  su2mixedfloat weight, local[(nBlk > 0)? nBlk*nBlk : 1];
+  su2mixedfloat *block = (nBlk > 0)? local : work;
+  su2double aux;
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
-    step++;
-    if (col_ind[index] == block_j) {
-      for (iVar = 0; iVar < nVar; iVar++)
-        for (jVar = 0; jVar < nEqn; jVar++)
-//          matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = val_block[iVar][jVar];  // Allow AD in Matrix Structure (disabled temporarily to avoid conflicts)
-          matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = SU2_TYPE::GetValue(val_block[iVar][jVar]);
-      break;
+  /*--- Copy block matrix, note that the original matrix
+   is modified by the algorithm---*/
+  
+  for (iVar = 0; iVar < n*n; iVar++)
+    block[iVar] = Block[iVar];
+  
+  if (n == 1) {
+    rhs[0] /= block[0];
+    return;
+  }
+  
+  /*--- Transform system in Upper Matrix ---*/
+  
+  for (iVar = 1; iVar < n; iVar++) {
+    for (jVar = 0; jVar < iVar; jVar++) {
+      weight = block[iVar*n+jVar] / block[jVar*n+jVar];
+      for (kVar = jVar; kVar < n; kVar++)
+        block[iVar*n+kVar] -= weight*block[jVar*n+kVar];
+      rhs[iVar] -= weight*rhs[jVar];
     }
   }
   
+  /*--- Backwards substitution ---*/
+  
+  rhs[n-1] = rhs[n-1] / block[n*n-1];
+  for (iVar = n-2; iVar >= 0; iVar--) {
+    aux = 0.0;
+    for (jVar = iVar+1; jVar < n; jVar++)
+      aux += block[iVar*n+jVar]*rhs[jVar];
+    rhs[iVar] = (rhs[iVar]-aux) / block[iVar*n+iVar];
+  }
+  
 }
+
+template<unsigned short nBlk>
+void CSysMatrix::BlockKernel_Inverse(unsigned short val_n, const su2mixedfloat *Block, su2mixedfloat *invBlock, su2mixedfloat *work) {
   
-void CSysMatrix::SetBlock(unsigned long block_i, unsigned long block_j, su2double *val_block) {
+  const short n = (nBlk > 0)? nBlk : val_n;
+  short iVar, jVar, kVar, iCol;
+  su2mixedfloat weight, aux, local[(nBlk > 0)? nBlk*nBlk : 1];
+  su2mixedfloat *block = (nBlk > 0)? local : work;
   
-  unsigned long iVar, jVar, index, step = 0;
+  /*--- Same operations as Gauss elimination with the columns of the identity
+   as right hand sides, but the elimination is done once for all of them.
+   The columns of the inverse are built in place (invBlock is column-major
+   during the elimination and transposed at the end). ---*/
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
-    step++;
-    if (col_ind[index] == block_j) {
-      for (iVar = 0; iVar < nVar; iVar++)
-        for (jVar = 0; jVar < nEqn; jVar++)
-//          matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = val_block[iVar*nVar+jVar];  // Allow AD in Matrix Structure (disabled temporarily to avoid conflicts)
-          matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = SU2_TYPE::GetValue(val_block[iVar*nVar+jVar]);
-      break;
+  for (iVar = 0; iVar < n*n; iVar++) {
+    block[iVar] = Block[iVar];
+    invBlock[iVar] = 0.0;
+  }
+  for (iVar = 0; iVar < n; iVar++)
+    invBlock[iVar*n+iVar] = 1.0;
+  
+  if (n == 1) {
+    invBlock[0] /= block[0];
+    return;
+  }
+  
+  /*--- Transform system in Upper Matrix ---*/
+  
+  for (iVar = 1; iVar < n; iVar++) {
+    for (jVar = 0; jVar < iVar; jVar++) {
+      weight = block[iVar*n+jVar] / block[jVar*n+jVar];
+      for (kVar = jVar; kVar < n; kVar++)
+        block[iVar*n+kVar] -= weight*block[jVar*n+kVar];
+      for (iCol = 0; iCol < n; iCol++)
+        invBlock[iCol*n+iVar] -= weight*invBlock[iCol*n+jVar];
     }
   }
   
+  /*--- Backwards substitution ---*/
+  
+  for (iCol = 0; iCol < n; iCol++) {
+    su2mixedfloat *rhs = &invBlock[iCol*n];
+    rhs[n-1] = rhs[n-1] / block[n*n-1];
+    for (iVar = n-2; iVar >= 0; iVar--) {
+      aux = 0.0;
+      for (jVar = iVar+1; jVar < n; jVar++)
+        aux += block[iVar*n+jVar]*rhs[jVar];
+      rhs[iVar] = (rhs[iVar]-aux) / block[iVar*n+iVar];
+    }
+  }
+  
+  /*--- Column-major to row-major ---*/
+  
+  for (iVar = 0; iVar < n; iVar++)
+    for (jVar = iVar+1; jVar < n; jVar++) {
+      aux = invBlock[iVar*n+jVar];
+      invBlock[iVar*n+jVar] = invBlock[jVar*n+iVar];
+      invBlock[jVar*n+iVar] = aux;
+    }
+  
 }
 
-void CSysMatrix::AddBlock(unsigned long block_i, unsigned long block_j, su2double **val_block) {
+void CSysMatrix::SetBlock_Kernels(void) {
   
-  unsigned long iVar, jVar, index, step = 0;
+  /*--- Fully unrolled kernels for the small block sizes, e.g. the 1x1 and 2x2
+   turbulence blocks and the 5x5, 6x6 and 7x7 flow blocks. ---*/
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
-    step++;
-    if (col_ind[index] == block_j) {
-      for (iVar = 0; iVar < nVar; iVar++)
-        for (jVar = 0; jVar < nEqn; jVar++)
-//          matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] += val_block[iVar][jVar];  // Allow AD in Matrix Structure (disabled temporarily to avoid conflicts)
-          matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] += SU2_TYPE::GetValue(val_block[iVar][jVar]);
+  switch (nVar) {
+    case 1:
+      Block_MatVec = &BlockKernel_MatVec<1>; Block_MatMat  = &BlockKernel_MatMat<1>;
+      Block_Solve  = &BlockKernel_Solve<1>;  Block_Inverse = &BlockKernel_Inverse<1>;
+      break;
+    case 2:
+      Block_MatVec = &BlockKernel_MatVec<2>; Block_MatMat  = &BlockKernel_MatMat<2>;
+      Block_Solve  = &BlockKernel_Solve<2>;  Block_Inverse = &BlockKernel_Inverse<2>;
+      break;
+    case 3:
+      Block_MatVec = &BlockKernel_MatVec<3>; Block_MatMat  = &BlockKernel_MatMat<3>;
+      Block_Solve  = &BlockKernel_Solve<3>;  Block_Inverse = &BlockKernel_Inverse<3>;
+      break;
+    case 4:
+      Block_MatVec = &BlockKernel_MatVec<4>; Block_MatMat  = &BlockKernel_MatMat<4>;
+      Block_Solve  = &BlockKernel_Solve<4>;  Block_Inverse = &BlockKernel_Inverse<4>;
+      break;
+    case 5:
+      Block_MatVec = &BlockKernel_MatVec<5>; Block_MatMat  = &BlockKernel_MatMat<5>;
+      Block_Solve  = &BlockKernel_Solve<5>;  Block_Inverse = &BlockKernel_Inverse<5>;
+      break;
+    case 6:
+      Block_MatVec = &BlockKernel_MatVec<6>; Block_MatMat  = &BlockKernel_MatMat<6>;
+      Block_Solve  = &BlockKernel_Solve<6>;  Block_Inverse = &BlockKernel_Inverse<6>;
+      break;
+    case 7:
+      Block_MatVec = &BlockKernel_MatVec<7>; Block_MatMat  = &BlockKernel_MatMat<7>;
+      Block_Solve  = &BlockKernel_Solve<7>;  Block_Inverse = &BlockKernel_Inverse<7>;
+      break;
+    default:
+      Block_MatVec = &BlockKernel_MatVec<0>; Block_MatMat  = &BlockKernel_MatMat<0>;
+      Block_Solve  = &BlockKernel_Solve<0>;  Block_Inverse = &BlockKernel_Inverse<0>;
       break;
-    }
   }
   
 }
 
+su2mixedfloat *CSysMatrix::GetBlock(unsigned long block_i, unsigned long block_j) {
+  
+  unsigned long index = GetBlock_Position(block_i, block_j);
+  
+  if (index == nnz) return NULL;
+  return &(matrix[index*nVar*nEqn]);
+  
+}
+
+su2double CSysMatrix::GetBlock(unsigned long block_i, unsigned long block_j, unsigned short iVar, unsigned short jVar) {
+  
+  unsigned long index = GetBlock_Position(block_i, block_j);
+  
+  if (index == nnz) return 0;
+  return matrix[index*nVar*nEqn+iVar*nEqn+jVar];
+  
+}
+
+void CSysMatrix::SetBlock(unsigned long block_i, unsigned long block_j, su2double **val_block) {
+  
+  unsigned long iVar, jVar, index = GetBlock_Position(block_i, block_j);
+  
+  if (index == nnz) return;
+  
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (jVar = 0; jVar < nEqn; jVar++)
+//      matrix[index*nVar*nEqn+iVar*nEqn+jVar] = val_block[iVar][jVar];  // Allow AD in Matrix Structure (disabled temporarily to avoid conflicts)
+      matrix[index*nVar*nEqn+iVar*nEqn+jVar] = SU2_TYPE::GetValue(val_block[iVar][jVar]);
+  
+}
+  
+void CSysMatrix::SetBlock(unsigned long block_i, unsigned long block_j, su2double *val_block) {
+  
+  unsigned long iVar, jVar, index = GetBlock_Position(block_i, block_j);
+  
+  if (index == nnz) return;
+  
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (jVar = 0; jVar < nEqn; jVar++)
+//      matrix[index*nVar*nEqn+iVar*nEqn+jVar] = val_block[iVar*nVar+jVar];  // Allow AD in Matrix Structure (disabled temporarily to avoid conflicts)
+      matrix[index*nVar*nEqn+iVar*nEqn+jVar] = SU2_TYPE::GetValue(val_block[iVar*nVar+jVar]);
+  
+}
+
+void CSysMatrix::AddBlock(unsigned long block_i, unsigned long block_j, su2double **val_block) {
+  
+  unsigned long iVar, jVar, index = GetBlock_Position(block_i, block_j);
+  
+  if (index == nnz) return;
+  
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (jVar = 0; jVar < nEqn; jVar++)
+//      matrix[index*nVar*nEqn+iVar*nEqn+jVar] += val_block[iVar][jVar];  // Allow AD in Matrix Structure (disabled temporarily to avoid conflicts)
+      matrix[index*nVar*nEqn+iVar*nEqn+jVar] += SU2_TYPE::GetValue(val_block[iVar][jVar]);
+  
+}
+
 void CSysMatrix::SubtractBlock(unsigned long block_i, unsigned long block_j, su2double **val_block) {
   
-  unsigned long iVar, jVar, index, step = 0;
+  unsigned long iVar, jVar, index = GetBlock_Position(block_i, block_j);
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
-    step++;
-    if (col_ind[index] == block_j) {
-      for (iVar = 0; iVar < nVar; iVar++)
-        for (jVar = 0; jVar < nEqn; jVar++)
-//         matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] -= val_block[iVar][jVar];  // Allow AD in Matrix Structure (disabled temporarily to avoid conflicts)
-          matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] -= SU2_TYPE::GetValue(val_block[iVar][jVar]);
-      break;
+  if (index == nnz) return;
+  
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (jVar = 0; jVar < nEqn; jVar++)
+//      matrix[index*nVar*nEqn+iVar*nEqn+jVar] -= val_block[iVar][jVar];  // Allow AD in Matrix Structure (disabled temporarily to avoid conflicts)
+      matrix[index*nVar*nEqn+iVar*nEqn+jVar] -= SU2_TYPE::GetValue(val_block[iVar][jVar]);
+  
+}
+
+void CSysMatrix::UpdateBlocks(unsigned long iEdge, su2double **block_i, su2double **block_j) {
+  
+  unsigned long iVar, jVar, offset;
+  
+  su2mixedfloat *mat_ii = &matrix[edge_ptr[4*iEdge  ]*nVar*nEqn];
+  su2mixedfloat *mat_ij = &matrix[edge_ptr[4*iEdge+1]*nVar*nEqn];
+  su2mixedfloat *mat_ji = &matrix[edge_ptr[4*iEdge+2]*nVar*nEqn];
+  su2mixedfloat *mat_jj = &matrix[edge_ptr[4*iEdge+3]*nVar*nEqn];
+  
+  for (iVar = 0; iVar < nVar; iVar++) {
+    for (jVar = 0; jVar < nEqn; jVar++) {
+      offset = iVar*nEqn+jVar;
+      mat_ii[offset] += SU2_TYPE::GetValue(block_i[iVar][jVar]);
+      mat_ij[offset] += SU2_TYPE::GetValue(block_j[iVar][jVar]);
+      mat_ji[offset] -= SU2_TYPE::GetValue(block_i[iVar][jVar]);
+      mat_jj[offset] -= SU2_TYPE::GetValue(block_j[iVar][jVar]);
+    }
+  }
+  
+}
+
+void CSysMatrix::UpdateBlocks_Sub(unsigned long iEdge, su2double **block_i, su2double **block_j) {
+  
+  unsigned long iVar, jVar, offset;
+  
+  su2mixedfloat *mat_ii = &matrix[edge_ptr[4*iEdge  ]*nVar*nEqn];
+  su2mixedfloat *mat_ij = &matrix[edge_ptr[4*iEdge+1]*nVar*nEqn];
+  su2mixedfloat *mat_ji = &matrix[edge_ptr[4*iEdge+2]*nVar*nEqn];
+  su2mixedfloat *mat_jj = &matrix[edge_ptr[4*iEdge+3]*nVar*nEqn];
+  
+  for (iVar = 0; iVar < nVar; iVar++) {
+    for (jVar = 0; jVar < nEqn; jVar++) {
+      offset = iVar*nEqn+jVar;
+      mat_ii[offset] -= SU2_TYPE::GetValue(block_i[iVar][jVar]);
+      mat_ij[offset] -= SU2_TYPE::GetValue(block_j[iVar][jVar]);
+      mat_ji[offset] += SU2_TYPE::GetValue(block_i[iVar][jVar]);
+      mat_jj[offset] += SU2_TYPE::GetValue(block_j[iVar][jVar]);
+    }
+  }
+  
+}
+
+void CSysMatrix::UpdateBlocks(unsigned long iEdge, su2double *block_i, su2double *block_j, unsigned short val_stride) {
+  
+  unsigned long iVar, jVar, offset;
+  
+  su2mixedfloat *mat_ii = &matrix[edge_ptr[4*iEdge  ]*nVar*nEqn];
+  su2mixedfloat *mat_ij = &matrix[edge_ptr[4*iEdge+1]*nVar*nEqn];
+  su2mixedfloat *mat_ji = &matrix[edge_ptr[4*iEdge+2]*nVar*nEqn];
+  su2mixedfloat *mat_jj = &matrix[edge_ptr[4*iEdge+3]*nVar*nEqn];
+  
+  for (iVar = 0; iVar < nVar; iVar++) {
+    for (jVar = 0; jVar < nEqn; jVar++) {
+      offset = iVar*nEqn+jVar;
+      mat_ii[offset] += SU2_TYPE::GetValue(block_i[offset*val_stride]);
+      mat_ij[offset] += SU2_TYPE::GetValue(block_j[offset*val_stride]);
+      mat_ji[offset] -= SU2_TYPE::GetValue(block_i[offset*val_stride]);
+      mat_jj[offset] -= SU2_TYPE::GetValue(block_j[offset*val_stride]);
+    }
+  }
+  
+}
+
+void CSysMatrix::UpdateBlocks_Sub(unsigned long iEdge, su2double *block_i, su2double *block_j, unsigned short val_stride) {
+  
+  unsigned long iVar, jVar, offset;
+  
+  su2mixedfloat *mat_ii = &matrix[edge_ptr[4*iEdge  ]*nVar*nEqn];
+  su2mixedfloat *mat_ij = &matrix[edge_ptr[4*iEdge+1]*nVar*nEqn];
+  su2mixedfloat *mat_ji = &matrix[edge_ptr[4*iEdge+2]*nVar*nEqn];
+  su2mixedfloat *mat_jj = &matrix[edge_ptr[4*iEdge+3]*nVar*nEqn];
+  
+  for (iVar = 0; iVar < nVar; iVar++) {
+    for (jVar = 0; jVar < nEqn; jVar++) {
+      offset = iVar*nEqn+jVar;
+      mat_ii[offset] -= SU2_TYPE::GetValue(block_i[offset*val_stride]);
+      mat_ij[offset] -= SU2_TYPE::GetValue(block_j[offset*val_stride]);
+      mat_ji[offset] += SU2_TYPE::GetValue(block_i[offset*val_stride]);
+      mat_jj[offset] += SU2_TYPE::GetValue(block_j[offset*val_stride]);
     }
   }
   
 }
 
-su2double *CSysMatrix::GetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j) {
+su2mixedfloat *CSysMatrix::GetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j) {
   
   unsigned long step = 0, index;
   
@@ -481,7 +852,7 @@ su2double *CSysMatrix::GetBlock_ILUMatrix(unsigned long block_i, unsigned long b
   
 }
 
-void CSysMatrix::SetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j, su2double *val_block) {
+void CSysMatrix::SetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j, su2mixedfloat *val_block) {
   
   unsigned long iVar, jVar, index, step = 0;
   
@@ -497,7 +868,7 @@ void CSysMatrix::SetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j
   
 }
 
-void CSysMatrix::SetBlockTransposed_ILUMatrix(unsigned long block_i, unsigned long block_j, su2double *val_block) {
+void CSysMatrix::SetBlockTransposed_ILUMatrix(unsigned long block_i, unsigned long block_j, su2mixedfloat *val_block) {
 
   unsigned long iVar, jVar, index, step = 0;
 
@@ -513,7 +884,7 @@ void CSysMatrix::SetBlockTransposed_ILUMatrix(unsigned long block_i, unsigned lo
 
 }
 
-void CSysMatrix::SubtractBlock_ILUMatrix(unsigned long block_i, unsigned long block_j, su2double *val_block) {
+void CSysMatrix::SubtractBlock_ILUMatrix(unsigned long block_i, unsigned long block_j, su2mixedfloat *val_block) {
   
   unsigned long iVar, jVar, index, step = 0;
   
@@ -529,69 +900,43 @@ void CSysMatrix::SubtractBlock_ILUMatrix(unsigned long block_i, unsigned long bl
   
 }
 
-void CSysMatrix::MatrixVectorProduct(su2double *matrix, su2double *vector, su2double *product) {
+void CSysMatrix::MatrixVectorProduct(su2mixedfloat *matrix, su2double *vector, su2double *product) {
   
-  unsigned short iVar, jVar;
-  
-  for (iVar = 0; iVar < nVar; iVar++) {
-    product[iVar] = 0.0;
-    for (jVar = 0; jVar < nVar; jVar++) {
-      product[iVar] += matrix[iVar*nVar+jVar] * vector[jVar];
-    }
-  }
+  (*Block_MatVec)(nVar, matrix, vector, product);
   
 }
 
-void CSysMatrix::MatrixMatrixProduct(su2double *matrix_a, su2double *matrix_b, su2double *product) {
+void CSysMatrix::MatrixMatrixProduct(su2mixedfloat *matrix_a, su2mixedfloat *matrix_b, su2mixedfloat *product) {
   
-  unsigned short iVar, jVar, kVar;
-
-  for (iVar = 0; iVar < nVar; iVar++) {
-    for (jVar = 0; jVar < nVar; jVar++) {
-      product[iVar*nVar+jVar] = 0.0;
-      for (kVar = 0; kVar < nVar; kVar++) {
-        product[iVar*nVar+jVar] += matrix_a[iVar*nVar+kVar]*matrix_b[kVar*nVar+jVar];
-      }
-    }
-  }
+  (*Block_MatMat)(nVar, matrix_a, matrix_b, product);
   
 }
 
 void CSysMatrix::AddVal2Diag(unsigned long block_i, su2double val_matrix) {
   
-  unsigned long step = 0, iVar, index;
+  unsigned long iVar, index = GetBlock_Position(block_i, block_i);
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
-    step++;
-    if (col_ind[index] == block_i) {	// Only elements on the diagonal
-      for (iVar = 0; iVar < nVar; iVar++)
-//        matrix[(row_ptr[block_i]+step-1)*nVar*nVar+iVar*nVar+iVar] += val_matrix;  // Allow AD in Matrix Structure (disabled temporarily to avoid conflicts)
-        matrix[(row_ptr[block_i]+step-1)*nVar*nVar+iVar*nVar+iVar] += SU2_TYPE::GetValue(val_matrix);
-      break;
-    }
-  }
+  if (index == nnz) return;
+  
+  for (iVar = 0; iVar < nVar; iVar++)
+//    matrix[index*nVar*nVar+iVar*nVar+iVar] += val_matrix;  // Allow AD in Matrix Structure (disabled temporarily to avoid conflicts)
+    matrix[index*nVar*nVar+iVar*nVar+iVar] += SU2_TYPE::GetValue(val_matrix);
   
 }
 
 void CSysMatrix::SetVal2Diag(unsigned long block_i, su2double val_matrix) {
   
-  unsigned long step = 0, iVar, jVar, index;
+  unsigned long iVar, jVar, index = GetBlock_Position(block_i, block_i);
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
-    step++;
-    if (col_ind[index] == block_i) {	// Only elements on the diagonal
-      
-      for (iVar = 0; iVar < nVar; iVar++)
-        for (jVar = 0; jVar < nVar; jVar++)
-          matrix[(row_ptr[block_i]+step-1)*nVar*nVar+iVar*nVar+jVar] = 0.0;
-      
-      for (iVar = 0; iVar < nVar; iVar++)
-//        matrix[(row_ptr[block_i]+step-1)*nVar*nVar+iVar*nVar+iVar] = val_matrix;  // Allow AD in Matrix Structure (disabled temporarily to avoid conflicts)
-        matrix[(row_ptr[block_i]+step-1)*nVar*nVar+iVar*nVar+iVar] = SU2_TYPE::GetValue(val_matrix);
-      
-      break;
-    }
-  }
+  if (index == nnz) return;
+  
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (jVar = 0; jVar < nVar; jVar++)
+      matrix[index*nVar*nVar+iVar*nVar+jVar] = 0.0;
+  
+  for (iVar = 0; iVar < nVar; iVar++)
+//    matrix[index*nVar*nVar+iVar*nVar+iVar] = val_matrix;  // Allow AD in Matrix Structure (disabled temporarily to avoid conflicts)
+    matrix[index*nVar*nVar+iVar*nVar+iVar] = SU2_TYPE::GetValue(val_matrix);
   
 }
 
@@ -708,138 +1053,34 @@ void CSysMatrix::MatrixTranspose(su2double **a, unsigned long n) {
 
 void CSysMatrix::Gauss_Elimination(unsigned long block_i, su2double* rhs, bool transposed) {
   
-  short iVar, jVar, kVar; // This is important, otherwise some compilers optimizations will fail
-  su2double weight, aux;
+  unsigned short iVar, jVar;
   
-  su2double *Block = GetBlock(block_i, block_i);
+  su2mixedfloat *Block = GetBlock(block_i, block_i);
   
-  /*--- Copy block matrix, note that the original matrix
-   is modified by the algorithm---*/
+  /*--- The kernel works on a copy, so the original matrix is not modified.
+   The transposed block is built in the scratch block, which the generic
+   kernel can also use as its copy. ---*/
   
   if (!transposed) {
-    for (iVar = 0; iVar < (short)nVar; iVar++)
-      for (jVar = 0; jVar < (short)nVar; jVar++)
-        block[iVar*nVar+jVar] = Block[iVar*nVar+jVar];
+    (*Block_Solve)(nVar, Block, rhs, block);
   } else {
-    for (iVar = 0; iVar < (short)nVar; iVar++)
-      for (jVar = 0; jVar < (short)nVar; jVar++)
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (jVar = 0; jVar < nVar; jVar++)
         block[iVar*nVar+jVar] = Block[jVar*nVar+iVar];
-  }
-  /*--- Gauss elimination ---*/
-  
-  if (nVar == 1) {
-    rhs[0] /= block[0];
-  }
-  else {
-    
-    /*--- Transform system in Upper Matrix ---*/
-    
-    for (iVar = 1; iVar < (short)nVar; iVar++) {
-      for (jVar = 0; jVar < iVar; jVar++) {
-        weight = block[iVar*nVar+jVar] / block[jVar*nVar+jVar];
-        for (kVar = jVar; kVar < (short)nVar; kVar++)
-          block[iVar*nVar+kVar] -= weight*block[jVar*nVar+kVar];
-        rhs[iVar] -= weight*rhs[jVar];
-      }
-    }
-    
-    /*--- Backwards substitution ---*/
-    
-    rhs[nVar-1] = rhs[nVar-1] / block[nVar*nVar-1];
-    for (iVar = (short)nVar-2; iVar >= 0; iVar--) {
-      aux = 0.0;
-      for (jVar = iVar+1; jVar < (short)nVar; jVar++)
-        aux += block[iVar*nVar+jVar]*rhs[jVar];
-      rhs[iVar] = (rhs[iVar]-aux) / block[iVar*nVar+iVar];
-      if (iVar == 0) break;
-    }
+    (*Block_Solve)(nVar, block, rhs, block);
   }
   
 }
 
 void CSysMatrix::Gauss_Elimination_ILUMatrix(unsigned long block_i, su2double* rhs) {
   
-  short iVar, jVar, kVar; // This is important, otherwise some compilers optimizations will fail
-  su2double weight, aux;
-  
-  su2double *Block = GetBlock_ILUMatrix(block_i, block_i);
-  
-  /*--- Copy block matrix, note that the original matrix
-   is modified by the algorithm---*/
-  
-  for (iVar = 0; iVar < (short)nVar; iVar++)
-    for (jVar = 0; jVar < (short)nVar; jVar++)
-      block[iVar*nVar+jVar] = Block[iVar*nVar+jVar];
-  
-  /*--- Gauss elimination ---*/
-
-  if (nVar == 1) {
-    rhs[0] /= block[0];
-  }
-  else {
-    
-    /*--- Transform system in Upper Matrix ---*/
-    
-    for (iVar = 1; iVar < (short)nVar; iVar++) {
-      for (jVar = 0; jVar < iVar; jVar++) {
-        weight = block[iVar*nVar+jVar] / block[jVar*nVar+jVar];
-        for (kVar = jVar; kVar < (short)nVar; kVar++)
-          block[iVar*nVar+kVar] -= weight*block[jVar*nVar+kVar];
-        rhs[iVar] -= weight*rhs[jVar];
-      }
-    }
-    
-    /*--- Backwards substitution ---*/
-    
-    rhs[nVar-1] = rhs[nVar-1] / block[nVar*nVar-1];
-    for (iVar = (short)nVar-2; iVar >= 0; iVar--) {
-      aux = 0.0;
-      for (jVar = iVar+1; jVar < (short)nVar; jVar++)
-        aux += block[iVar*nVar+jVar]*rhs[jVar];
-      rhs[iVar] = (rhs[iVar]-aux) / block[iVar*nVar+iVar];
-      if (iVar == 0) break;
-    }
-  }
+  (*Block_Solve)(nVar, GetBlock_ILUMatrix(block_i, block_i), rhs, block);
   
 }
 
-void CSysMatrix::Gauss_Elimination(su2double* Block, su2double* rhs) {
-  
-  short iVar, jVar, kVar; // This is important, otherwise some compilers optimizations will fail
-  su2double weight, aux;
-  
-  /*--- Copy block matrix, note that the original matrix
-   is modified by the algorithm---*/
-  
-  for (iVar = 0; iVar < (short)nVar; iVar++)
-    for (jVar = 0; jVar < (short)nVar; jVar++)
-      block[iVar*nVar+jVar] = Block[iVar*nVar+jVar];
+void CSysMatrix::Gauss_Elimination(su2mixedfloat* Block, su2double* rhs) {
   
-  
-  if (nVar == 1) {
-    rhs[0] /= block[0];
-  }
-  else {
-    /*--- Transform system in Upper Matrix ---*/
-    for (iVar = 1; iVar < (short)nVar; iVar++) {
-      for (jVar = 0; jVar < iVar; jVar++) {
-        weight = block[iVar*nVar+jVar] / block[jVar*nVar+jVar];
-        for (kVar = jVar; kVar < (short)nVar; kVar++)
-          block[iVar*nVar+kVar] -= weight*block[jVar*nVar+kVar];
-        rhs[iVar] -= weight*rhs[jVar];
-      }
-    }
-    
-    /*--- Backwards substitution ---*/
-    rhs[nVar-1] = rhs[nVar-1] / block[nVar*nVar-1];
-    for (iVar = (short)nVar-2; iVar >= 0; iVar--) {
-      aux = 0.0;
-      for (jVar = iVar+1; jVar < (short)nVar; jVar++)
-        aux += block[iVar*nVar+jVar]*rhs[jVar];
-      rhs[iVar] = (rhs[iVar]-aux) / block[iVar*nVar+iVar];
-      if (iVar == 0) break;
-    }
-  }
+  (*Block_Solve)(nVar, Block, rhs, block);
   
 }
 
@@ -848,7 +1089,7 @@ void CSysMatrix::ProdBlockVector(unsigned long block_i, unsigned long block_j, c
   unsigned long j = block_j*nVar;
   unsigned short iVar, jVar;
   
-  su2double *block = GetBlock(block_i, block_j);
+  su2mixedfloat *block = GetBlock(block_i, block_j);
   
   for (iVar = 0; iVar < nVar; iVar++) {
     prod_block_vector[iVar] = 0;
@@ -972,29 +1213,138 @@ void CSysMatrix::SendReceive_Solution(CSysVector & x, CGeometry *geometry, CConf
       
       delete [] Buffer_Send;
       
-      /*--- Do the coordinate transformation ---*/
+      /*--- Do the coordinate transformation ---*/
+      
+      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
+        
+        /*--- Find point and its type of transformation ---*/
+        
+        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
+        
+        /*--- Copy transformed conserved variables back into buffer. ---*/
+        
+        for (iVar = 0; iVar < nVar; iVar++)
+          x[iPoint*nVar+iVar] = Buffer_Receive[iVertex*nVar+iVar];
+        
+      }
+      
+      /*--- Deallocate receive buffer ---*/
+      
+      delete [] Buffer_Receive;
+      
+    }
+    
+  }
+  
+}
+
+void CSysMatrix::SendReceive_Solution_Start(CSysVector & x, CGeometry *geometry, CConfig *config) {
+  
+#ifdef HAVE_MPI
+  
+  unsigned short iVar, iMarker, MarkerS, MarkerR;
+  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector = 0, nBufferR_Vector = 0,
+  OffsetS = 0, OffsetR = 0;
+  int send_to, receive_from, nPair = 0;
+  
+  /*--- Size the buffers for all the send/receive markers at once ---*/
+  
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
+        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
+      nBufferS_Vector += geometry->nVertex[iMarker]*nVar;
+      nBufferR_Vector += geometry->nVertex[iMarker+1]*nVar;
+      nPair++;
+    }
+  }
+  
+  Halo_Buffer_Send = new su2double [nBufferS_Vector];
+  Halo_Buffer_Recv = new su2double [nBufferR_Vector];
+  Halo_Request = new SU2_MPI::Request [2*nPair];
+  nHalo_Request = 0;
+  
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    
+    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
+        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
+      
+      MarkerS = iMarker;  MarkerR = iMarker+1;
+      
+      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
+      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
+      
+      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
+      
+      /*--- Post the receive first, then copy the solution that should be sended ---*/
+      
+      SU2_MPI::Irecv(&Halo_Buffer_Recv[OffsetR], nVertexR*nVar, MPI_DOUBLE, receive_from, 0,
+                     MPI_COMM_WORLD, &Halo_Request[nHalo_Request++]);
+      
+      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
+        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
+        for (iVar = 0; iVar < nVar; iVar++)
+          Halo_Buffer_Send[OffsetS+iVertex*nVar+iVar] = x[iPoint*nVar+iVar];
+      }
+      
+      SU2_MPI::Isend(&Halo_Buffer_Send[OffsetS], nVertexS*nVar, MPI_DOUBLE, send_to, 0,
+                     MPI_COMM_WORLD, &Halo_Request[nHalo_Request++]);
+      
+      OffsetS += nVertexS*nVar;  OffsetR += nVertexR*nVar;
+      
+    }
+    
+  }
+  
+#endif
+  
+}
+
+void CSysMatrix::SendReceive_Solution_Finish(CSysVector & x, CGeometry *geometry, CConfig *config) {
+  
+#ifdef HAVE_MPI
+  
+  unsigned short iVar, iMarker, MarkerR;
+  unsigned long iVertex, iPoint, nVertexR, OffsetR = 0;
+  SU2_MPI::Status *status = new SU2_MPI::Status [nHalo_Request];
+  
+  SU2_MPI::Waitall(nHalo_Request, Halo_Request, status);
+  
+  /*--- Copy the received values into the halo points ---*/
+  
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    
+    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
+        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
+      
+      MarkerR = iMarker+1;
+      nVertexR = geometry->nVertex[MarkerR];
       
       for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        
         iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        
-        /*--- Copy transformed conserved variables back into buffer. ---*/
-        
         for (iVar = 0; iVar < nVar; iVar++)
-          x[iPoint*nVar+iVar] = Buffer_Receive[iVertex*nVar+iVar];
-        
+          x[iPoint*nVar+iVar] = Halo_Buffer_Recv[OffsetR+iVertex*nVar+iVar];
       }
       
-      /*--- Deallocate receive buffer ---*/
-      
-      delete [] Buffer_Receive;
+      OffsetR += nVertexR*nVar;
       
     }
     
   }
   
+  delete [] status;
+  delete [] Halo_Buffer_Send;  Halo_Buffer_Send = NULL;
+  delete [] Halo_Buffer_Recv;  Halo_Buffer_Recv = NULL;
+  delete [] Halo_Request;      Halo_Request = NULL;
+  nHalo_Request = 0;
+  
+#else
+  
+  /*--- Without MPI only the periodic copies remain, done in one step ---*/
+  
+  SendReceive_Solution(x, geometry, config);
+  
+#endif
+  
 }
 
 void CSysMatrix::SendReceive_SolutionTransposed(CSysVector & x, CGeometry *geometry, CConfig *config) {
@@ -1112,9 +1462,124 @@ void CSysMatrix::MatrixVectorProduct(const CSysVector & vec, CSysVector & prod)
   
 }
 
+void CSysMatrix::SetRow_Order(CGeometry *geometry, CConfig *config) {
+  
+  unsigned short iMarker;
+  unsigned long iPoint, iVertex, iRow;
+  bool *Row_Send = new bool [nPointDomain];
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    Row_Send[iPoint] = false;
+  
+  /*--- Owned points that are copied to other ranks by SendReceive_Solution ---*/
+  
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
+        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
+      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        if (iPoint < nPointDomain) Row_Send[iPoint] = true;
+      }
+    }
+  }
+  
+  /*--- Sent rows first and then the interior ones, both in ascending order ---*/
+  
+  if (Row_Order != NULL) delete [] Row_Order;
+  Row_Order = new unsigned long [nPointDomain];
+  
+  iRow = 0;
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    if (Row_Send[iPoint]) Row_Order[iRow++] = iPoint;
+  nRow_Send = iRow;
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    if (!Row_Send[iPoint]) Row_Order[iRow++] = iPoint;
+  
+  delete [] Row_Send;
+  
+}
+
+template<unsigned short nBlk>
+void CSysMatrix::RowRangeProduct(const su2double *vec, su2double *prod, unsigned long iRow_begin, unsigned long iRow_end) const {
+  
+  unsigned long iRow, row_i, index;
+  unsigned short iVar, jVar;
+  const su2mixedfloat *mat_ij;
+  const su2double *vec_j;
+  su2double sum[nBlk];
+  
+  /*--- The block size is known at compile time, the block loops are unrolled and
+   the row sums are kept in registers. Rows are split among the threads. ---*/
+  
+  SU2_OMP(for schedule(static))
+  for (iRow = iRow_begin; iRow < iRow_end; iRow++) {
+    
+    row_i = Row_Order[iRow];
+    
+    for (iVar = 0; iVar < nBlk; iVar++)
+      sum[iVar] = 0.0;
+    
+    for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
+      mat_ij = &matrix[index*nBlk*nBlk];
+      vec_j = &vec[col_ind[index]*nBlk];
+      for (iVar = 0; iVar < nBlk; iVar++)
+        for (jVar = 0; jVar < nBlk; jVar++)
+          sum[iVar] += mat_ij[iVar*nBlk+jVar]*vec_j[jVar];
+    }
+    
+    for (iVar = 0; iVar < nBlk; iVar++)
+      prod[row_i*nBlk+iVar] = sum[iVar];
+    
+  }
+  
+}
+
+void CSysMatrix::RowRangeProduct_Generic(const su2double *vec, su2double *prod, unsigned long iRow_begin, unsigned long iRow_end) const {
+  
+  unsigned long iRow, row_i, index, iVar, jVar;
+  const su2mixedfloat *mat_ij;
+  const su2double *vec_j;
+  su2double *prod_i;
+  
+  SU2_OMP(for schedule(static))
+  for (iRow = iRow_begin; iRow < iRow_end; iRow++) {
+    
+    row_i = Row_Order[iRow];
+    prod_i = &prod[row_i*nVar];
+    
+    for (iVar = 0; iVar < nVar; iVar++)
+      prod_i[iVar] = 0.0;
+    
+    for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
+      mat_ij = &matrix[index*nVar*nVar];
+      vec_j = &vec[col_ind[index]*nVar];
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (jVar = 0; jVar < nVar; jVar++)
+          prod_i[iVar] += mat_ij[iVar*nVar+jVar]*vec_j[jVar];
+    }
+    
+  }
+  
+}
+
+void CSysMatrix::RowRangeProduct_Block(const su2double *vec, su2double *prod, unsigned long iRow_begin, unsigned long iRow_end) const {
+  
+  switch (nVar) {
+    case 1: RowRangeProduct<1>(vec, prod, iRow_begin, iRow_end); break;
+    case 2: RowRangeProduct<2>(vec, prod, iRow_begin, iRow_end); break;
+    case 3: RowRangeProduct<3>(vec, prod, iRow_begin, iRow_end); break;
+    case 4: RowRangeProduct<4>(vec, prod, iRow_begin, iRow_end); break;
+    case 5: RowRangeProduct<5>(vec, prod, iRow_begin, iRow_end); break;
+    case 6: RowRangeProduct<6>(vec, prod, iRow_begin, iRow_end); break;
+    case 7: RowRangeProduct<7>(vec, prod, iRow_begin, iRow_end); break;
+    default: RowRangeProduct_Generic(vec, prod, iRow_begin, iRow_end); break;
+  }
+  
+}
+
 void CSysMatrix::MatrixVectorProduct(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
   
-  unsigned long prod_begin, vec_begin, mat_begin, index, iVar, jVar, row_i;
+  unsigned long iPoint;
   
   /*--- Some checks for consistency between CSysMatrix and the CSysVectors ---*/
   if ( (nVar != vec.GetNVar()) || (nVar != prod.GetNVar()) ) {
@@ -1127,23 +1592,33 @@ void CSysMatrix::MatrixVectorProduct(const CSysVector & vec, CSysVector & prod,
     << "nPoint and nBlk values incompatible." << endl;
     throw(-1);
   }
+  if (nPoint == 0) return;
   
-  prod = su2double(0.0); // set all entries of prod to zero
-  for (row_i = 0; row_i < nPointDomain; row_i++) {
-    prod_begin = row_i*nVar; // offset to beginning of block row_i
-    for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
-      vec_begin = col_ind[index]*nVar; // offset to beginning of block col_ind[index]
-      mat_begin = (index*nVar*nVar); // offset to beginning of matrix block[row_i][col_ind[indx]]
-      for (iVar = 0; iVar < nVar; iVar++) {
-        for (jVar = 0; jVar < nVar; jVar++) {
-          prod[(unsigned long)(prod_begin+iVar)] += matrix[(unsigned long)(mat_begin+iVar*nVar+jVar)]*vec[(unsigned long)(vec_begin+jVar)];
-        }
-      }
-    }
+  if (Row_Order == NULL) SetRow_Order(geometry, config);
+  
+  const su2double *vec_val = &vec[0];
+  su2double *prod_val = &prod[0];
+  
+  /*--- The halo rows are not computed, they are received ---*/
+  
+  for (iPoint = nPointDomain*nVar; iPoint < nPoint*nVar; iPoint++)
+    prod_val[iPoint] = 0.0;
+  
+  /*--- The rows that are sent to other ranks are computed first, the exchange
+   is then started and overlapped with the product of the interior rows. ---*/
+  
+  SU2_OMP(parallel)
+  {
+    RowRangeProduct_Block(vec_val, prod_val, 0, nRow_Send);
+    
+    SU2_OMP(master)
+    SendReceive_Solution_Start(prod, geometry, config);
+    
+    RowRangeProduct_Block(vec_val, prod_val, nRow_Send, nPointDomain);
   }
   
   /*--- MPI Parallelization ---*/
-  SendReceive_Solution(prod, geometry, config);
+  SendReceive_Solution_Finish(prod, geometry, config);
   
 }
 
@@ -1178,32 +1653,19 @@ void CSysMatrix::MatrixVectorProductTransposed(const CSysVector & vec, CSysVecto
 
 }
 
-void CSysMatrix::GetMultBlockBlock(su2double *c, su2double *a, su2double *b) {
+void CSysMatrix::GetMultBlockBlock(su2mixedfloat *c, su2mixedfloat *a, su2mixedfloat *b) {
   
-  unsigned long iVar, jVar, kVar;
-  
-  for (iVar = 0; iVar < nVar; iVar++)
-    for (jVar = 0; jVar < nVar; jVar++) {
-      c[iVar*nVar+jVar] = 0.0;
-      for (kVar = 0; kVar < nVar; kVar++)
-        c[iVar*nVar+jVar] += a[iVar*nVar+kVar] * b[kVar*nVar+jVar];
-    }
+  (*Block_MatMat)(nVar, a, b, c);
   
 }
 
-void CSysMatrix::GetMultBlockVector(su2double *c, su2double *a, su2double *b) {
-  
-  unsigned long iVar, jVar;
+void CSysMatrix::GetMultBlockVector(su2double *c, su2mixedfloat *a, su2double *b) {
   
-  for (iVar = 0; iVar < nVar; iVar++) {
-    c[iVar] =  0.0;
-    for (jVar = 0; jVar < nVar; jVar++)
-      c[iVar] += a[iVar*nVar+jVar] * b[jVar];
-  }
+  (*Block_MatVec)(nVar, a, b, c);
   
 }
 
-void CSysMatrix::GetSubsBlock(su2double *c, su2double *a, su2double *b) {
+void CSysMatrix::GetSubsBlock(su2mixedfloat *c, su2mixedfloat *a, su2mixedfloat *b) {
   
   unsigned long iVar, jVar;
   
@@ -1222,38 +1684,27 @@ void CSysMatrix::GetSubsVector(su2double *c, su2double *a, su2double *b) {
   
 }
 
-void CSysMatrix::InverseBlock(su2double *Block, su2double *invBlock) {
-  
-  unsigned long iVar, jVar;
+void CSysMatrix::InverseBlock(su2mixedfloat *Block, su2mixedfloat *invBlock) {
   
-  for (iVar = 0; iVar < nVar; iVar++) {
-    for (jVar = 0; jVar < nVar; jVar++)
-      aux_vector[jVar] = 0.0;
-    aux_vector[iVar] = 1.0;
-    
-    /*--- Compute the i-th column of the inverse matrix ---*/
-    Gauss_Elimination(Block, aux_vector);
-    
-    for (jVar = 0; jVar < nVar; jVar++)
-      invBlock[jVar*nVar+iVar] = aux_vector[jVar];
-  }
+  (*Block_Inverse)(nVar, Block, invBlock, block);
   
 }
 
-void CSysMatrix::InverseDiagonalBlock(unsigned long block_i, su2double *invBlock, bool transpose) {
+void CSysMatrix::InverseDiagonalBlock(unsigned long block_i, su2mixedfloat *invBlock, bool transpose) {
   
   unsigned long iVar, jVar;
   
-  for (iVar = 0; iVar < nVar; iVar++) {
-    for (jVar = 0; jVar < nVar; jVar++)
-      aux_vector[jVar] = 0.0;
-    aux_vector[iVar] = 1.0;
-    
-    /*--- Compute the i-th column of the inverse matrix ---*/
-    
-    Gauss_Elimination(block_i, aux_vector, transpose);
-    for (jVar = 0; jVar < nVar; jVar++)
-      invBlock[jVar*nVar+iVar] = aux_vector[jVar];
+  su2mixedfloat *Block = GetBlock(block_i, block_i);
+  
+  /*--- All the columns of the inverse matrix are computed with one elimination ---*/
+  
+  if (!transpose) {
+    (*Block_Inverse)(nVar, Block, invBlock, block);
+  } else {
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (jVar = 0; jVar < nVar; jVar++)
+        block[iVar*nVar+jVar] = Block[jVar*nVar+iVar];
+    (*Block_Inverse)(nVar, block, invBlock, block);
   }
   
   //  su2double Det, **Matrix, **CoFactor;
@@ -1291,21 +1742,11 @@ void CSysMatrix::InverseDiagonalBlock(unsigned long block_i, su2double *invBlock
 }
 
 
-void CSysMatrix::InverseDiagonalBlock_ILUMatrix(unsigned long block_i, su2double *invBlock) {
+void CSysMatrix::InverseDiagonalBlock_ILUMatrix(unsigned long block_i, su2mixedfloat *invBlock) {
   
-  unsigned long iVar, jVar;
-
-  for (iVar = 0; iVar < nVar; iVar++) {
-    for (jVar = 0; jVar < nVar; jVar++)
-      aux_vector[jVar] = 0.0;
-    aux_vector[iVar] = 1.0;
-    
-    /*--- Compute the i-th column of the inverse matrix ---*/
-    
-    Gauss_Elimination_ILUMatrix(block_i, aux_vector);
-    for (jVar = 0; jVar < nVar; jVar++)
-      invBlock[jVar*nVar+iVar] = aux_vector[jVar];
-  }
+  /*--- All the columns of the inverse matrix are computed with one elimination ---*/
+  
+  (*Block_Inverse)(nVar, GetBlock_ILUMatrix(block_i, block_i), invBlock, block);
   
   //  su2double Det, **Matrix, **CoFactor;
   //  su2double *Block = GetBlock_ILUMatrix(block_i, block_i);
@@ -1472,7 +1913,7 @@ unsigned long CSysMatrix::Jacobi_Smoother(const CSysVector & b, CSysVector & x,
 void CSysMatrix::BuildILUPreconditioner(bool transposed) {
   
   unsigned long index, index_, iVar;
-  su2double *Block_ij, *Block_jk;
+  su2mixedfloat *Block_ij, *Block_jk;
   long iPoint, jPoint, kPoint;
   
 
@@ -1555,7 +1996,7 @@ void CSysMatrix::BuildILUPreconditioner(bool transposed) {
 void CSysMatrix::ComputeILUPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
   
   unsigned long index;
-  su2double *Block_ij;
+  su2mixedfloat *Block_ij;
   long iPoint, jPoint;
   unsigned short iVar;
   
@@ -1619,7 +2060,8 @@ void CSysMatrix::ComputeILUPreconditioner(const CSysVector & vec, CSysVector & p
 unsigned long CSysMatrix::ILU_Smoother(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec, su2double tol, unsigned long m, su2double *residual, bool monitoring, CGeometry *geometry, CConfig *config) {
   
   unsigned long index;
-  su2double *Block_ij, omega = 1.0;
+  su2mixedfloat *Block_ij;
+  su2double omega = 1.0;
   long iPoint, jPoint;
   unsigned short iVar;
   
@@ -2079,22 +2521,22 @@ unsigned short CSysMatrix::BuildLineletPreconditioner(CGeometry *geometry, CConf
   
   /*--- Memory allocation --*/
   
-  UBlock = new su2double* [max_nElem];
-  invUBlock = new su2double* [max_nElem];
-  LBlock = new su2double* [max_nElem];
+  UBlock = new su2mixedfloat* [max_nElem];
+  invUBlock = new su2mixedfloat* [max_nElem];
+  LBlock = new su2mixedfloat* [max_nElem];
   yVector = new su2double* [max_nElem];
   zVector = new su2double* [max_nElem];
   rVector = new su2double* [max_nElem];
   for (iElem = 0; iElem < max_nElem; iElem++) {
-    UBlock[iElem] = new su2double [nVar*nVar];
-    invUBlock[iElem] = new su2double [nVar*nVar];
-    LBlock[iElem] = new su2double [nVar*nVar];
+    UBlock[iElem] = new su2mixedfloat [nVar*nVar];
+    invUBlock[iElem] = new su2mixedfloat [nVar*nVar];
+    LBlock[iElem] = new su2mixedfloat [nVar*nVar];
     yVector[iElem] = new su2double [nVar];
     zVector[iElem] = new su2double [nVar];
     rVector[iElem] = new su2double [nVar];
   }
   
-  LFBlock = new su2double [nVar*nVar];
+  LFBlock = new su2mixedfloat [nVar*nVar];
   LyVector = new su2double [nVar];
   FzVector = new su2double [nVar];
   
@@ -2111,7 +2553,7 @@ void CSysMatrix::ComputeLineletPreconditioner(const CSysVector & vec, CSysVector
   
   unsigned long iVar, jVar, nElem = 0, iLinelet, im1Point, iPoint, ip1Point, iElem;
   long iElemLoop;
-  su2double *block;
+  su2mixedfloat *block;
   
   if (size == SINGLE_NODE) {
     
@@ -2209,6 +2651,458 @@ void CSysMatrix::ComputeLineletPreconditioner(const CSysVector & vec, CSysVector
   
 }
 
+void CSysMatrix::SetAMG_Hierarchy(void) {
+  
+  /*--- Limits of the hierarchy: maximum number of levels, size of the coarsest level
+   (solved with a dense factorization) and minimum reduction of the number of rows. ---*/
+  
+  const unsigned short MAX_LEVEL = 12;
+  const unsigned long MIN_BLK = 32, MAX_DENSE = 512;
+  const double MIN_RATIO = 0.8;
+  const su2double STRENGTH = 0.08;
+  
+  unsigned short iLevel;
+  unsigned long iRow, jRow, iAgg, jAgg, index, nRow, nAgg, nnz_coarse, pos, iBlk, best;
+  unsigned long *rp, *ci, *parent, *agg_ptr, *agg_row, *marker, *marker_pos;
+  su2double *norm, *diag_norm, val, best_val;
+  su2mixedfloat *mat;
+  bool free_seed;
+  
+  const unsigned long nBlk2 = nVar*nVar;
+  
+  if (nVar != nEqn)
+    SU2_MPI::Error("The AMG preconditioner requires square blocks (nVar = nEqn).", CURRENT_FUNCTION);
+  
+  AMG_nBlk     = new unsigned long [MAX_LEVEL];
+  AMG_nnz      = new unsigned long [MAX_LEVEL];
+  AMG_row_ptr  = new unsigned long* [MAX_LEVEL];
+  AMG_col_ind  = new unsigned long* [MAX_LEVEL];
+  AMG_dia_ptr  = new unsigned long* [MAX_LEVEL];
+  AMG_Parent   = new unsigned long* [MAX_LEVEL];
+  AMG_Galerkin = new unsigned long* [MAX_LEVEL];
+  AMG_matrix   = new su2mixedfloat* [MAX_LEVEL];
+  AMG_invDiag  = new su2mixedfloat* [MAX_LEVEL];
+  AMG_Rhs      = new su2double* [MAX_LEVEL];
+  AMG_Sol      = new su2double* [MAX_LEVEL];
+  AMG_Res      = new su2double* [MAX_LEVEL];
+
+  for (iLevel = 0; iLevel < MAX_LEVEL; iLevel++) {
+    AMG_Parent[iLevel] = NULL; AMG_Galerkin[iLevel] = NULL;
+  }
+  
+  /*--- The first level is the matrix itself, restricted to the rows and
+   columns of the owned points (the preconditioner is local to each rank). ---*/
+  
+  AMG_nBlk[0]    = nPointDomain;
+  AMG_nnz[0]     = nnz;
+  AMG_row_ptr[0] = row_ptr;
+  AMG_col_ind[0] = col_ind;
+  AMG_matrix[0]  = matrix;
+  AMG_dia_ptr[0] = new unsigned long [nPointDomain];
+  for (iRow = 0; iRow < nPointDomain; iRow++) {
+    AMG_dia_ptr[0][iRow] = nnz;
+    for (index = row_ptr[iRow]; index < row_ptr[iRow+1]; index++)
+      if (col_ind[index] == iRow) AMG_dia_ptr[0][iRow] = index;
+    if (AMG_dia_ptr[0][iRow] == nnz)
+      SU2_MPI::Error("The AMG preconditioner requires the diagonal blocks in the sparse structure.", CURRENT_FUNCTION);
+  }
+  
+  nAMG_Level = 1;
+  
+  while (nAMG_Level < MAX_LEVEL) {
+    
+    iLevel = nAMG_Level-1;
+    nRow = AMG_nBlk[iLevel];
+    rp   = AMG_row_ptr[iLevel];
+    ci   = AMG_col_ind[iLevel];
+    mat  = AMG_matrix[iLevel];
+    
+    if (nRow <= MIN_BLK) break;
+    
+    /*--- Strength of the couplings, ||A_ij|| >= STRENGTH*sqrt(||A_ii||*||A_jj||) ---*/
+    
+    norm = new su2double [rp[nRow]];
+    diag_norm = new su2double [nRow];
+    for (index = 0; index < rp[nRow]; index++) {
+      norm[index] = 0.0;
+      for (iBlk = 0; iBlk < nBlk2; iBlk++)
+        norm[index] += mat[index*nBlk2+iBlk]*mat[index*nBlk2+iBlk];
+      norm[index] = sqrt(norm[index]);
+    }
+    for (iRow = 0; iRow < nRow; iRow++)
+      diag_norm[iRow] = norm[AMG_dia_ptr[iLevel][iRow]];
+    
+    /*--- Greedy aggregation, as for the agglomeration of the geometric multigrid: a row with
+     no aggregated strong neighbour is the seed of a new aggregate with its free strong neighbours. ---*/
+    
+    parent = new unsigned long [nRow];
+    for (iRow = 0; iRow < nRow; iRow++) parent[iRow] = nRow;
+    
+    nAgg = 0;
+    for (iRow = 0; iRow < nRow; iRow++) {
+      if (parent[iRow] != nRow) continue;
+      free_seed = true;
+      for (index = rp[iRow]; index < rp[iRow+1]; index++) {
+        jRow = ci[index];
+        if ((jRow >= nRow) || (jRow == iRow)) continue;
+        if ((norm[index] >= STRENGTH*sqrt(diag_norm[iRow]*diag_norm[jRow])) && (parent[jRow] != nRow)) {
+          free_seed = false; break;
+        }
+      }
+      if (!free_seed) continue;
+      parent[iRow] = nAgg;
+      for (index = rp[iRow]; index < rp[iRow+1]; index++) {
+        jRow = ci[index];
+        if ((jRow >= nRow) || (jRow == iRow)) continue;
+        if (norm[index] >= STRENGTH*sqrt(diag_norm[iRow]*diag_norm[jRow])) parent[jRow] = nAgg;
+      }
+      nAgg++;
+    }
+    
+    /*--- The remaining rows join the aggregate of their strongest neighbour ---*/
+    
+    for (iRow = 0; iRow < nRow; iRow++) {
+      if (parent[iRow] != nRow) continue;
+      best = nRow; best_val = 0.0;
+      for (index = rp[iRow]; index < rp[iRow+1]; index++) {
+        jRow = ci[index];
+        if ((jRow >= nRow) || (jRow == iRow) || (parent[jRow] == nRow)) continue;
+        if (norm[index] > best_val) { best = parent[jRow]; best_val = norm[index]; }
+      }
+      if (best == nRow) { best = nAgg; nAgg++; }
+      parent[iRow] = best;
+    }
+    
+    delete [] norm;
+    delete [] diag_norm;
+    
+    /*--- Stop if the coarsening stagnates ---*/
+    
+    if (double(nAgg) > MIN_RATIO*double(nRow)) {
+      delete [] parent;
+      break;
+    }
+    
+    /*--- Rows of each aggregate (counting sort) ---*/
+    
+    agg_ptr = new unsigned long [nAgg+1];
+    agg_row = new unsigned long [nRow];
+    for (iAgg = 0; iAgg <= nAgg; iAgg++) agg_ptr[iAgg] = 0;
+    for (iRow = 0; iRow < nRow; iRow++) agg_ptr[parent[iRow]+1]++;
+    for (iAgg = 0; iAgg < nAgg; iAgg++) agg_ptr[iAgg+1] += agg_ptr[iAgg];
+    for (iRow = 0; iRow < nRow; iRow++) agg_row[agg_ptr[parent[iRow]]++] = iRow;
+    for (iAgg = nAgg; iAgg > 0; iAgg--) agg_ptr[iAgg] = agg_ptr[iAgg-1];
+    agg_ptr[0] = 0;
+    
+    /*--- Sparse structure of the next level (Galerkin product with the piecewise constant
+     prolongation), block (I,J) exists if a block (i,j) exists with i in I and j in J. ---*/
+    
+    marker = new unsigned long [nAgg];
+    marker_pos = new unsigned long [nAgg];
+    for (iAgg = 0; iAgg < nAgg; iAgg++) marker[iAgg] = nAgg;
+    
+    nnz_coarse = 0;
+    for (iAgg = 0; iAgg < nAgg; iAgg++) {
+      for (pos = agg_ptr[iAgg]; pos < agg_ptr[iAgg+1]; pos++) {
+        iRow = agg_row[pos];
+        for (index = rp[iRow]; index < rp[iRow+1]; index++) {
+          if (ci[index] >= nRow) continue;
+          jAgg = parent[ci[index]];
+          if (marker[jAgg] != iAgg) { marker[jAgg] = iAgg; nnz_coarse++; }
+        }
+      }
+    }
+    
+    AMG_nBlk[iLevel+1]    = nAgg;
+    AMG_nnz[iLevel+1]     = nnz_coarse;
+    AMG_row_ptr[iLevel+1] = new unsigned long [nAgg+1];
+    AMG_col_ind[iLevel+1] = new unsigned long [nnz_coarse];
+    AMG_dia_ptr[iLevel+1] = new unsigned long [nAgg];
+    AMG_Galerkin[iLevel]  = new unsigned long [AMG_nnz[iLevel]];
+    
+    for (index = 0; index < AMG_nnz[iLevel]; index++) AMG_Galerkin[iLevel][index] = nnz_coarse;
+    for (iAgg = 0; iAgg < nAgg; iAgg++) marker[iAgg] = nAgg;
+    
+    AMG_row_ptr[iLevel+1][0] = 0;
+    nnz_coarse = 0;
+    for (iAgg = 0; iAgg < nAgg; iAgg++) {
+      for (pos = agg_ptr[iAgg]; pos < agg_ptr[iAgg+1]; pos++) {
+        iRow = agg_row[pos];
+        for (index = rp[iRow]; index < rp[iRow+1]; index++) {
+          if (ci[index] >= nRow) continue;
+          jAgg = parent[ci[index]];
+          if (marker[jAgg] != iAgg) {
+            marker[jAgg] = iAgg; marker_pos[jAgg] = nnz_coarse;
+            AMG_col_ind[iLevel+1][nnz_coarse] = jAgg;
+            if (jAgg == iAgg) AMG_dia_ptr[iLevel+1][iAgg] = nnz_coarse;
+            nnz_coarse++;
+          }
+          AMG_Galerkin[iLevel][index] = marker_pos[jAgg];
+        }
+      }
+      AMG_row_ptr[iLevel+1][iAgg+1] = nnz_coarse;
+    }
+    
+    AMG_matrix[iLevel+1] = new su2mixedfloat [nnz_coarse*nBlk2];
+    AMG_Parent[iLevel]   = parent;
+    
+    delete [] agg_ptr;
+    delete [] agg_row;
+    delete [] marker;
+    delete [] marker_pos;
+    
+    nAMG_Level++;
+    
+  }
+  
+  /*--- Smoother and work vectors of each level ---*/
+  
+  for (iLevel = 0; iLevel < nAMG_Level; iLevel++) {
+    AMG_invDiag[iLevel] = new su2mixedfloat [AMG_nBlk[iLevel]*nBlk2];
+    AMG_Rhs[iLevel] = new su2double [AMG_nBlk[iLevel]*nVar];
+    AMG_Sol[iLevel] = new su2double [AMG_nBlk[iLevel]*nVar];
+    AMG_Res[iLevel] = new su2double [AMG_nBlk[iLevel]*nVar];
+    for (iRow = 0; iRow < AMG_nBlk[iLevel]*nVar; iRow++) {
+      AMG_Rhs[iLevel][iRow] = 0.0; AMG_Sol[iLevel][iRow] = 0.0; AMG_Res[iLevel][iRow] = 0.0;
+    }
+  }
+  
+  /*--- The coarsest level is factorized if it is small enough, otherwise it is smoothed ---*/
+  
+  nRow = AMG_nBlk[nAMG_Level-1]*nVar;
+  if (nRow <= MAX_DENSE) {
+    AMG_Coarse_LU   = new su2double [nRow*nRow];
+    AMG_Coarse_Perm = new unsigned long [nRow];
+  }
+  
+}
+
+void CSysMatrix::BuildAMGPreconditioner(void) {
+  
+  unsigned short iLevel;
+  unsigned long iRow, jRow, kRow, index, pos, iBlk, nRow, N;
+  su2double pivot, factor, swap;
+  
+  const unsigned long nBlk2 = nVar*nVar;
+  su2mixedfloat *work = new su2mixedfloat [nBlk2];
+  
+  /*--- The aggregation only depends on the sparse structure and is reused ---*/
+  
+  if (nAMG_Level == 0) SetAMG_Hierarchy();
+  
+  for (iLevel = 0; iLevel < nAMG_Level; iLevel++) {
+    
+    nRow = AMG_nBlk[iLevel];
+    
+    /*--- Inverse of the diagonal blocks for the block Gauss-Seidel smoother ---*/
+    
+    for (iRow = 0; iRow < nRow; iRow++)
+      (*Block_Inverse)(nVar, &AMG_matrix[iLevel][AMG_dia_ptr[iLevel][iRow]*nBlk2], &AMG_invDiag[iLevel][iRow*nBlk2], work);
+    
+    if (iLevel == nAMG_Level-1) break;
+    
+    /*--- Galerkin product R*A*P, with piecewise constant P (and R = P^T)
+     the coarse blocks are the sums of the blocks between two aggregates. ---*/
+    
+    for (index = 0; index < AMG_nnz[iLevel+1]*nBlk2; index++)
+      AMG_matrix[iLevel+1][index] = 0.0;
+    
+    for (iRow = 0; iRow < nRow; iRow++) {
+      for (index = AMG_row_ptr[iLevel][iRow]; index < AMG_row_ptr[iLevel][iRow+1]; index++) {
+        pos = AMG_Galerkin[iLevel][index];
+        if (pos == AMG_nnz[iLevel+1]) continue;
+        for (iBlk = 0; iBlk < nBlk2; iBlk++)
+          AMG_matrix[iLevel+1][pos*nBlk2+iBlk] += AMG_matrix[iLevel][index*nBlk2+iBlk];
+      }
+    }
+    
+  }
+  
+  delete [] work;
+  
+  /*--- Dense LU factorization (partial pivoting) of the coarsest level ---*/
+  
+  if (AMG_Coarse_LU != NULL) {
+    
+    iLevel = nAMG_Level-1;
+    nRow = AMG_nBlk[iLevel];
+    N = nRow*nVar;
+    
+    for (index = 0; index < N*N; index++) AMG_Coarse_LU[index] = 0.0;
+    for (iRow = 0; iRow < nRow; iRow++) {
+      for (index = AMG_row_ptr[iLevel][iRow]; index < AMG_row_ptr[iLevel][iRow+1]; index++) {
+        jRow = AMG_col_ind[iLevel][index];
+        for (iBlk = 0; iBlk < nBlk2; iBlk++)
+          AMG_Coarse_LU[(iRow*nVar+iBlk/nVar)*N + jRow*nVar+iBlk%nVar] = AMG_matrix[iLevel][index*nBlk2+iBlk];
+      }
+    }
+    
+    for (kRow = 0; kRow < N; kRow++) {
+      
+      pos = kRow; pivot = fabs(AMG_Coarse_LU[kRow*N+kRow]);
+      for (iRow = kRow+1; iRow < N; iRow++)
+        if (fabs(AMG_Coarse_LU[iRow*N+kRow]) > pivot) { pos = iRow; pivot = fabs(AMG_Coarse_LU[iRow*N+kRow]); }
+      
+      AMG_Coarse_Perm[kRow] = pos;
+      if (pos != kRow) {
+        for (jRow = 0; jRow < N; jRow++) {
+          swap = AMG_Coarse_LU[kRow*N+jRow];
+          AMG_Coarse_LU[kRow*N+jRow] = AMG_Coarse_LU[pos*N+jRow];
+          AMG_Coarse_LU[pos*N+jRow] = swap;
+        }
+      }
+      
+      /*--- Guard against singular coarse operators (e.g. pure Neumann problems) ---*/
+      
+      if (pivot < EPS) AMG_Coarse_LU[kRow*N+kRow] = EPS;
+      
+      for (iRow = kRow+1; iRow < N; iRow++) {
+        factor = AMG_Coarse_LU[iRow*N+kRow] / AMG_Coarse_LU[kRow*N+kRow];
+        AMG_Coarse_LU[iRow*N+kRow] = factor;
+        if (factor == 0.0) continue;
+        for (jRow = kRow+1; jRow < N; jRow++)
+          AMG_Coarse_LU[iRow*N+jRow] -= factor*AMG_Coarse_LU[kRow*N+jRow];
+      }
+      
+    }
+    
+  }
+  
+}
+
+void CSysMatrix::AMG_Residual(unsigned short iLevel) {
+  
+  unsigned long iRow, jRow, index;
+  unsigned short iVar;
+  
+  const unsigned long nRow = AMG_nBlk[iLevel], nBlk2 = nVar*nVar;
+  const unsigned long *rp = AMG_row_ptr[iLevel], *ci = AMG_col_ind[iLevel];
+  const su2mixedfloat *mat = AMG_matrix[iLevel];
+  const su2double *b = AMG_Rhs[iLevel], *x = AMG_Sol[iLevel];
+  su2double *r = AMG_Res[iLevel];
+  
+  for (iRow = 0; iRow < nRow; iRow++) {
+    for (iVar = 0; iVar < nVar; iVar++) r[iRow*nVar+iVar] = b[iRow*nVar+iVar];
+    for (index = rp[iRow]; index < rp[iRow+1]; index++) {
+      jRow = ci[index];
+      if (jRow >= nRow) continue;
+      (*Block_MatVec)(nVar, &mat[index*nBlk2], &x[jRow*nVar], aux_vector);
+      for (iVar = 0; iVar < nVar; iVar++) r[iRow*nVar+iVar] -= aux_vector[iVar];
+    }
+  }
+  
+}
+
+void CSysMatrix::AMG_Smooth(unsigned short iLevel, bool forward) {
+  
+  unsigned long iRow, jRow, index, iLoop;
+  unsigned short iVar;
+  
+  const unsigned long nRow = AMG_nBlk[iLevel], nBlk2 = nVar*nVar;
+  const unsigned long *rp = AMG_row_ptr[iLevel], *ci = AMG_col_ind[iLevel];
+  const su2mixedfloat *mat = AMG_matrix[iLevel], *invD = AMG_invDiag[iLevel];
+  const su2double *b = AMG_Rhs[iLevel];
+  su2double *x = AMG_Sol[iLevel];
+  
+  /*--- The update of each row uses the latest values of its neighbours ---*/
+  
+  for (iLoop = 0; iLoop < nRow; iLoop++) {
+    iRow = forward? iLoop : nRow-1-iLoop;
+    for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] = b[iRow*nVar+iVar];
+    for (index = rp[iRow]; index < rp[iRow+1]; index++) {
+      jRow = ci[index];
+      if (jRow >= nRow) continue;
+      (*Block_MatVec)(nVar, &mat[index*nBlk2], &x[jRow*nVar], aux_vector);
+      for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] -= aux_vector[iVar];
+    }
+    (*Block_MatVec)(nVar, &invD[iRow*nBlk2], sum_vector, aux_vector);
+    for (iVar = 0; iVar < nVar; iVar++) x[iRow*nVar+iVar] += aux_vector[iVar];
+  }
+  
+}
+
+void CSysMatrix::AMG_Cycle(unsigned short iLevel) {
+  
+  unsigned long iRow, kRow, N, index;
+  unsigned short iVar, iSweep, nSweep;
+  su2double swap;
+  
+  const unsigned long nRow = AMG_nBlk[iLevel];
+  const bool coarsest = (iLevel == nAMG_Level-1);
+  su2double *b = AMG_Rhs[iLevel], *x = AMG_Sol[iLevel], *r = AMG_Res[iLevel];
+  
+  /*--- Direct solution of the coarsest level ---*/
+  
+  if (coarsest && (AMG_Coarse_LU != NULL)) {
+    N = nRow*nVar;
+    for (kRow = 0; kRow < N; kRow++) x[kRow] = b[kRow];
+    for (kRow = 0; kRow < N; kRow++) {
+      swap = x[kRow]; x[kRow] = x[AMG_Coarse_Perm[kRow]]; x[AMG_Coarse_Perm[kRow]] = swap;
+    }
+    for (kRow = 1; kRow < N; kRow++)
+      for (index = 0; index < kRow; index++)
+        x[kRow] -= AMG_Coarse_LU[kRow*N+index]*x[index];
+    for (kRow = N; kRow > 0; kRow--) {
+      for (index = kRow; index < N; index++)
+        x[kRow-1] -= AMG_Coarse_LU[(kRow-1)*N+index]*x[index];
+      x[kRow-1] /= AMG_Coarse_LU[(kRow-1)*N+kRow-1];
+    }
+    return;
+  }
+  
+  /*--- Pre-smoothing (forward block Gauss-Seidel) from x = 0, the coarsest
+   level is smoothed with more sweeps if it is too large to be factorized. ---*/
+  
+  for (index = 0; index < nRow*nVar; index++) x[index] = 0.0;
+  
+  nSweep = coarsest? 4*AMG_nSweep : AMG_nSweep;
+  
+  for (iSweep = 0; iSweep < nSweep; iSweep++)
+    AMG_Smooth(iLevel, (!coarsest) || (iSweep%2 == 0));
+  
+  if (coarsest) return;
+  
+  /*--- Restriction of the residual (sum over each aggregate) and coarse grid correction ---*/
+  
+  AMG_Residual(iLevel);
+  
+  for (index = 0; index < AMG_nBlk[iLevel+1]*nVar; index++) AMG_Rhs[iLevel+1][index] = 0.0;
+  for (iRow = 0; iRow < nRow; iRow++)
+    for (iVar = 0; iVar < nVar; iVar++)
+      AMG_Rhs[iLevel+1][AMG_Parent[iLevel][iRow]*nVar+iVar] += r[iRow*nVar+iVar];
+  
+  AMG_Cycle(iLevel+1);
+  
+  for (iRow = 0; iRow < nRow; iRow++)
+    for (iVar = 0; iVar < nVar; iVar++)
+      x[iRow*nVar+iVar] += AMG_Sol[iLevel+1][AMG_Parent[iLevel][iRow]*nVar+iVar];
+  
+  /*--- Post-smoothing (backward block Gauss-Seidel), the cycle is symmetric for symmetric matrices ---*/
+  
+  for (iSweep = 0; iSweep < nSweep; iSweep++)
+    AMG_Smooth(iLevel, false);
+  
+}
+
+void CSysMatrix::ComputeAMGPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
+  
+  unsigned long index;
+  
+  if (nAMG_Level == 0)
+    SU2_MPI::Error("The AMG preconditioner has not been built.", CURRENT_FUNCTION);
+  
+  /*--- One V cycle on the owned points, the halo values are then exchanged (as for ILU) ---*/
+  
+  for (index = 0; index < nPointDomain*nVar; index++) AMG_Rhs[0][index] = vec[index];
+  
+  AMG_Cycle(0);
+  
+  for (index = 0; index < nPointDomain*nVar; index++) prod[index] = AMG_Sol[0][index];
+  
+  SendReceive_Solution(prod, geometry, config);
+  
+}
+
 void CSysMatrix::ComputeResidual(const CSysVector & sol, const CSysVector & f, CSysVector & res) {
   
   unsigned long iPoint, iVar;
@@ -41,6 +41,39 @@ int CBaseMPIWrapper::Rank = 0;
 int CBaseMPIWrapper::Size = 1;
 CBaseMPIWrapper::Comm CBaseMPIWrapper::currentComm = MPI_COMM_WORLD;
 
+void CSumReduction::Reduce(void) {
+
+  unsigned long iData, iEntry, nEntry = 0, iBuffer = 0;
+
+  for (iData = 0; iData < Size.size(); iData++) nEntry += Size[iData];
+
+  if (nEntry > 0) {
+
+    /*--- Pack all the local values in one buffer ---*/
+
+    Send_Buffer.resize(nEntry);
+    Recv_Buffer.resize(nEntry);
+
+    for (iData = 0; iData < Data.size(); iData++)
+      for (iEntry = 0; iEntry < Size[iData]; iEntry++)
+        Send_Buffer[iBuffer++] = Data[iData][iEntry];
+
+    SU2_MPI::Allreduce(&Send_Buffer[0], &Recv_Buffer[0], nEntry, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+
+    /*--- Scatter the global sums back to the registered values ---*/
+
+    iBuffer = 0;
+    for (iData = 0; iData < Data.size(); iData++)
+      for (iEntry = 0; iEntry < Size[iData]; iEntry++)
+        Data[iData][iEntry] = Recv_Buffer[iBuffer++];
+
+  }
+
+  Data.clear();
+  Size.clear();
+
+}
+
 #ifdef HAVE_MPI
 #if defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE
 //AMPI_ADOUBLE_TYPE* AMPI_ADOUBLE;
@@ -54,6 +54,171 @@
 
 using namespace std;
 
+/*!
+ * \brief Number of edges in the packs of the batched schemes, a multiple
+ *        of the number of doubles in the AVX2 and AVX-512 registers.
+ */
+const unsigned short BATCH_SIZE = 8;
+
+/*!
+ * \class CNumericsBatch
+ * \brief Pack with the data of several edges for the batched convective and viscous schemes.
+ * \details The data is stored by lanes (one lane per edge) so that the schemes process
+ *          all the lanes of a pack with unit stride: the variable iVar of the lane iLane is
+ *          at [iVar*BATCH_SIZE+iLane] and the Jacobian entry (iVar,jVar) is at
+ *          [(iVar*nVar+jVar)*BATCH_SIZE+iLane]. The schemes always compute the BATCH_SIZE
+ *          lanes, the unused lanes of a pack replicate its first edge.
+ */
+class CNumericsBatch {
+private:
+  unsigned short nDim, nVar,  /*!< \brief Number of dimensions and variables. */
+  nPrimVar,                   /*!< \brief Number of primitive variables in the pack (T, vel, P, rho, h, c, and mu_lam, mu_t if viscous). */
+  nEdge;                      /*!< \brief Number of edges in the pack. */
+  bool viscous;               /*!< \brief The pack holds the data of the viscous schemes. */
+  unsigned long Edge[BATCH_SIZE],  /*!< \brief Edge of each lane. */
+  Point_i[BATCH_SIZE],             /*!< \brief First point of the edge of each lane. */
+  Point_j[BATCH_SIZE];             /*!< \brief Second point of the edge of each lane. */
+  
+public:
+  su2double *Normal,  /*!< \brief Normal vectors of the edges. */
+  *V_i, *V_j,         /*!< \brief Primitive variables at points i and j. */
+  *Und_Lapl_i, *Und_Lapl_j;  /*!< \brief Undivided laplacians at points i and j (centered schemes). */
+  su2double Lambda_i[BATCH_SIZE], Lambda_j[BATCH_SIZE],  /*!< \brief Spectral radius at points i and j (centered schemes). */
+  Sensor_i[BATCH_SIZE], Sensor_j[BATCH_SIZE],            /*!< \brief Pressure sensor at points i and j (centered schemes). */
+  Neighbor_i[BATCH_SIZE], Neighbor_j[BATCH_SIZE];        /*!< \brief Number of neighbors of points i and j (centered schemes). */
+  su2double *Coord_i, *Coord_j,         /*!< \brief Coordinates of points i and j (viscous schemes). */
+  *PrimVar_Grad_i, *PrimVar_Grad_j;     /*!< \brief Gradients of T and vel at points i and j, (iVar,iDim) is at [(iVar*nDim+iDim)*BATCH_SIZE+iLane] (viscous schemes). */
+  su2double TurbKE_i[BATCH_SIZE], TurbKE_j[BATCH_SIZE];  /*!< \brief Turbulent kinetic energy at points i and j (viscous schemes). */
+  su2double *Residual,        /*!< \brief Residual of the edges. */
+  *Jacobian_i, *Jacobian_j;   /*!< \brief Jacobians of the residual with respect to points i and j. */
+  
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] val_nDim - Number of dimensions of the problem.
+   * \param[in] val_nVar - Number of variables of the problem.
+   * \param[in] val_viscous - Allocate the data of the viscous schemes.
+   */
+  CNumericsBatch(unsigned short val_nDim, unsigned short val_nVar, bool val_viscous);
+  
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CNumericsBatch(void);
+  
+  /*!
+   * \brief Add an edge to the pack.
+   * \param[in] val_edge - Index of the edge.
+   * \param[in] val_point_i - First point of the edge.
+   * \param[in] val_point_j - Second point of the edge.
+   * \param[in] val_normal - Normal vector of the edge.
+   * \param[in] val_v_i - Primitive variables at point i.
+   * \param[in] val_v_j - Primitive variables at point j.
+   * \return Lane of the edge in the pack.
+   */
+  unsigned short AddEdge(unsigned long val_edge, unsigned long val_point_i, unsigned long val_point_j,
+                         su2double *val_normal, su2double *val_v_i, su2double *val_v_j);
+  
+  /*!
+   * \brief Set the spectral radius of a lane.
+   * \param[in] val_lane - Lane of the edge.
+   * \param[in] val_lambda_i - Spectral radius at point i.
+   * \param[in] val_lambda_j - Spectral radius at point j.
+   */
+  void SetLambda(unsigned short val_lane, su2double val_lambda_i, su2double val_lambda_j);
+  
+  /*!
+   * \brief Set the pressure sensor of a lane.
+   * \param[in] val_lane - Lane of the edge.
+   * \param[in] val_sensor_i - Pressure sensor at point i.
+   * \param[in] val_sensor_j - Pressure sensor at point j.
+   */
+  void SetSensor(unsigned short val_lane, su2double val_sensor_i, su2double val_sensor_j);
+  
+  /*!
+   * \brief Set the number of neighbors of a lane.
+   * \param[in] val_lane - Lane of the edge.
+   * \param[in] val_neighbor_i - Number of neighbors of point i.
+   * \param[in] val_neighbor_j - Number of neighbors of point j.
+   */
+  void SetNeighbor(unsigned short val_lane, unsigned short val_neighbor_i, unsigned short val_neighbor_j);
+  
+  /*!
+   * \brief Set the undivided laplacians of a lane.
+   * \param[in] val_lane - Lane of the edge.
+   * \param[in] val_und_lapl_i - Undivided laplacians at point i.
+   * \param[in] val_und_lapl_j - Undivided laplacians at point j.
+   */
+  void SetUndivided_Laplacian(unsigned short val_lane, su2double *val_und_lapl_i, su2double *val_und_lapl_j);
+  
+  /*!
+   * \brief Set the coordinates of the points of a lane.
+   * \param[in] val_lane - Lane of the edge.
+   * \param[in] val_coord_i - Coordinates of point i.
+   * \param[in] val_coord_j - Coordinates of point j.
+   */
+  void SetCoord(unsigned short val_lane, su2double *val_coord_i, su2double *val_coord_j);
+  
+  /*!
+   * \brief Set the gradients of the primitive variables (T and vel) of a lane.
+   * \param[in] val_grad_i - Gradients at point i, stored as [iVar*nDim+iDim].
+   * \param[in] val_grad_j - Gradients at point j, stored as [iVar*nDim+iDim].
+   */
+  void SetPrimVarGradient(unsigned short val_lane, su2double *val_grad_i, su2double *val_grad_j);
+  
+  /*!
+   * \brief Set the turbulent kinetic energy of a lane.
+   * \param[in] val_lane - Lane of the edge.
+   * \param[in] val_turb_ke_i - Turbulent kinetic energy at point i.
+   * \param[in] val_turb_ke_j - Turbulent kinetic energy at point j.
+   */
+  void SetTurbKineticEnergy(unsigned short val_lane, su2double val_turb_ke_i, su2double val_turb_ke_j);
+  
+  /*!
+   * \brief Copy the first edge to the unused lanes of the pack.
+   */
+  void Fill(void);
+  
+  /*!
+   * \brief Remove all the edges from the pack.
+   */
+  void Clear(void);
+  
+  /*!
+   * \brief Get the number of edges in the pack.
+   * \return Number of edges.
+   */
+  unsigned short GetnEdge(void);
+  
+  /*!
+   * \brief Get the edge of a lane.
+   * \param[in] val_lane - Lane of the edge.
+   * \return Index of the edge.
+   */
+  unsigned long GetEdge(unsigned short val_lane);
+  
+  /*!
+   * \brief Get the first point of the edge of a lane.
+   * \param[in] val_lane - Lane of the edge.
+   * \return Index of the point.
+   */
+  unsigned long GetPoint_i(unsigned short val_lane);
+  
+  /*!
+   * \brief Get the second point of the edge of a lane.
+   * \param[in] val_lane - Lane of the edge.
+   * \return Index of the point.
+   */
+  unsigned long GetPoint_j(unsigned short val_lane);
+  
+  /*!
+   * \brief Copy the residual of a lane.
+   * \param[in] val_lane - Lane of the edge.
+   * \param[out] val_residual - Residual of the edge.
+   */
+  void GetResidual(unsigned short val_lane, su2double *val_residual);
+  
+};
+
 /*!
  * \class CNumerics
  * \brief Class for defining the numerical methods.
@@ -69,6 +234,8 @@ protected:
   su2double *Enthalpy_formation;
   su2double Prandtl_Lam;        /*!< \brief Laminar Prandtl's number. */
   su2double Prandtl_Turb;    /*!< \brief Turbulent Prandtl's number. */
+  unsigned short nThread_Numerics;  /*!< \brief Number of threads that have a copy of this numerics. */
+  CNumerics **Thread_Numerics;      /*!< \brief Copy of this numerics for each thread (the first one is this object). */
   
 public:
   
@@ -225,6 +392,22 @@ public:
    * \brief Destructor of the class.
    */
   virtual ~CNumerics(void);
+
+  /*!
+   * \brief Store an independent copy of this numerics for a thread of the edge loops,
+   *        the copies are owned (and deleted) by this object.
+   * \param[in] val_nthread - Number of threads.
+   * \param[in] val_thread - Index of the thread (greater than 0).
+   * \param[in] val_numerics - Numerics of the same kind to be used by the thread.
+   */
+  void SetThread_Numerics(unsigned short val_nthread, unsigned short val_thread, CNumerics *val_numerics);
+
+  /*!
+   * \brief Get the numerics that a thread must use in the edge loops.
+   * \param[in] val_thread - Index of the thread.
+   * \return Copy of the numerics for the thread, or this object if there are no copies.
+   */
+  CNumerics *GetThread_Numerics(unsigned short val_thread);
   
   /*!
    * \brief Compute the determinant of a 3 by 3 matrix.
@@ -845,6 +1028,31 @@ public:
                           su2double *val_normal, su2double val_scale,
                           su2double **val_Proj_Jac_tensor);
   
+  /*!
+   * \brief Compute the projected inviscid flux of the lanes of a pack (see CNumericsBatch for the layout).
+   * \param[in] val_density - Density of each lane.
+   * \param[in] val_velocity - Velocity of each lane.
+   * \param[in] val_pressure - Pressure of each lane.
+   * \param[in] val_enthalpy - Enthalpy of each lane.
+   * \param[in] val_normal - Normal vector of each lane.
+   * \param[out] val_Proj_Flux - Projected flux of each lane.
+   */
+  void GetInviscidProjFlux_Batch(su2double *val_density, su2double *val_velocity,
+                                 su2double *val_pressure, su2double *val_enthalpy,
+                                 su2double *val_normal, su2double *val_Proj_Flux);
+  
+  /*!
+   * \brief Compute the projected inviscid Jacobian of the lanes of a pack (see CNumericsBatch for the layout).
+   * \param[in] val_velocity - Velocity of each lane.
+   * \param[in] val_energy - Energy of each lane.
+   * \param[in] val_normal - Normal vector of each lane.
+   * \param[in] val_scale - Scale of the projection.
+   * \param[out] val_Proj_Jac_Tensor - Projected inviscid Jacobian of each lane.
+   */
+  void GetInviscidProjJac_Batch(su2double *val_velocity, su2double *val_energy,
+                                su2double *val_normal, su2double val_scale,
+                                su2double *val_Proj_Jac_Tensor);
+  
   /*!
    * \brief Compute the projection of the inviscid Jacobian matrices (artificial compresibility).
    * \param[in] val_density - Value of the density.
@@ -893,6 +1101,23 @@ public:
                           su2double **val_Proj_Jac_Tensor_i,
                           su2double **val_Proj_Jac_Tensor_j);
   
+  /*!
+   * \brief Viscous residual (average of gradients) and TSL-Approximation of the Jacobians of the lanes of a pack.
+   * \param[in,out] val_batch - Pack with the data of the edges, it receives the residuals and Jacobians.
+   * \param[in] val_correct - Correct the average of the gradients with the difference along the edge.
+   * \param[in] val_implicit - Compute the Jacobians.
+   */
+  void GetViscousResidual_Batch(CNumericsBatch *val_batch, bool val_correct, bool val_implicit);
+  
+  /*!
+   * \brief Kernel of GetViscousResidual_Batch for a fixed number of dimensions.
+   * \param[in,out] val_batch - Pack with the data of the edges, it receives the residuals and Jacobians.
+   * \param[in] val_correct - Correct the average of the gradients with the difference along the edge.
+   * \param[in] val_implicit - Compute the Jacobians.
+   */
+  template<unsigned short nDim_>
+  void GetViscousResidual_Batch_Dim(CNumericsBatch *val_batch, bool val_correct, bool val_implicit);
+  
   /*!
    * \brief TSL-Approximation of Viscous NS Jacobians for arbitrary equations of state.
    * \param[in] val_Mean_PrimVar - Mean value of the primitive variables.
@@ -1103,6 +1328,30 @@ public:
   void GetPMatrix_inv(su2double *val_density, su2double *val_velocity,
                       su2double *val_soundspeed, su2double *val_normal,
                       su2double **val_invp_tensor);
+  
+  /*!
+   * \brief Computation of the matrix P of the lanes of a pack (see CNumericsBatch for the layout).
+   * \param[in] val_density - Density of each lane.
+   * \param[in] val_velocity - Velocity of each lane.
+   * \param[in] val_soundspeed - Sound speed of each lane.
+   * \param[in] val_normal - Unit normal vector of each lane.
+   * \param[out] val_p_tensor - P matrix of each lane.
+   */
+  void GetPMatrix_Batch(su2double *val_density, su2double *val_velocity,
+                        su2double *val_soundspeed, su2double *val_normal,
+                        su2double *val_p_tensor);
+  
+  /*!
+   * \brief Computation of the matrix P^{-1} of the lanes of a pack (see CNumericsBatch for the layout).
+   * \param[in] val_density - Density of each lane.
+   * \param[in] val_velocity - Velocity of each lane.
+   * \param[in] val_soundspeed - Sound speed of each lane.
+   * \param[in] val_normal - Unit normal vector of each lane.
+   * \param[out] val_invp_tensor - Inverse of the P matrix of each lane.
+   */
+  void GetPMatrix_inv_Batch(su2double *val_density, su2double *val_velocity,
+                            su2double *val_soundspeed, su2double *val_normal,
+                            su2double *val_invp_tensor);
 
   /*!
    * \brief Computation of the matrix P^{-1} (artificial compresibility), this matrix diagonalize the conservative Jacobians
@@ -1177,6 +1426,19 @@ public:
   virtual void ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i,
                                su2double **val_Jacobian_j, CConfig *config);
   
+  /*!
+   * \brief Whether the scheme computes packs of edges with ComputeResidual_Batch.
+   * \return <code>TRUE</code> if the batched residual is available; otherwise <code>FALSE</code>.
+   */
+  virtual bool GetBatched(void);
+  
+  /*!
+   * \brief Compute the residual and the Jacobians of all the lanes of a pack of edges.
+   * \param[in,out] val_batch - Pack with the data of the edges, it receives the residuals and Jacobians.
+   * \param[in] config - Definition of the particular problem.
+   */
+  virtual void ComputeResidual_Batch(CNumericsBatch *val_batch, CConfig *config);
+  
   /*!
    * \overload
    * \param[out] val_residual - Pointer to the total residual.
@@ -1609,6 +1871,19 @@ public:
    */
   void ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config);
   
+  /*!
+   * \brief Whether the scheme computes packs of edges (not with grid movement or low dissipation).
+   * \return <code>TRUE</code> if the batched residual is available; otherwise <code>FALSE</code>.
+   */
+  bool GetBatched(void);
+  
+  /*!
+   * \brief Compute the Roe's flux of all the lanes of a pack of edges.
+   * \param[in,out] val_batch - Pack with the data of the edges, it receives the residuals and Jacobians.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeResidual_Batch(CNumericsBatch *val_batch, CConfig *config);
+  
 };
 
 
@@ -2189,6 +2464,19 @@ public:
    * \param[in] config - Definition of the particular problem.
    */
   void ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config);
+  
+  /*!
+   * \brief Whether the scheme computes packs of edges (not with grid movement).
+   * \return <code>TRUE</code> if the batched residual is available; otherwise <code>FALSE</code>.
+   */
+  bool GetBatched(void);
+  
+  /*!
+   * \brief Compute the HLLC flux of all the lanes of a pack of edges.
+   * \param[in,out] val_batch - Pack with the data of the edges, it receives the residuals and Jacobians.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeResidual_Batch(CNumericsBatch *val_batch, CConfig *config);
 
 };
 
@@ -2692,6 +2980,19 @@ public:
    */
   void ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j,
                        CConfig *config);
+  
+  /*!
+   * \brief Whether the scheme computes packs of edges (not with grid movement).
+   * \return <code>TRUE</code> if the batched residual is available; otherwise <code>FALSE</code>.
+   */
+  bool GetBatched(void);
+  
+  /*!
+   * \brief Compute the flow residual using a JST method of all the lanes of a pack of edges.
+   * \param[in,out] val_batch - Pack with the data of the edges, it receives the residuals and Jacobians.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeResidual_Batch(CNumericsBatch *val_batch, CConfig *config);
 };
 
 /*!
@@ -3134,6 +3435,19 @@ public:
    * \param[in] config - Definition of the particular problem.
    */
   void ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config);
+  
+  /*!
+   * \brief Whether the scheme computes packs of edges.
+   * \return <code>TRUE</code> since the batched residual is always available.
+   */
+  bool GetBatched(void);
+  
+  /*!
+   * \brief Compute the viscous flow residual of all the lanes of a pack using an average of gradients.
+   * \param[in,out] val_batch - Pack with the data of the edges, it receives the residuals and Jacobians.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeResidual_Batch(CNumericsBatch *val_batch, CConfig *config);
 };
 
 /*!
@@ -3548,6 +3862,19 @@ public:
    * \param[in] config - Definition of the particular problem.
    */
   void ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config);
+  
+  /*!
+   * \brief Whether the scheme computes packs of edges.
+   * \return <code>TRUE</code> since the batched residual is always available.
+   */
+  bool GetBatched(void);
+  
+  /*!
+   * \brief Compute the viscous flow residual of all the lanes of a pack using an average of gradients with correction.
+   * \param[in,out] val_batch - Pack with the data of the edges, it receives the residuals and Jacobians.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeResidual_Batch(CNumericsBatch *val_batch, CConfig *config);
 };
 
 
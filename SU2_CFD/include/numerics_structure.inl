@@ -51,6 +51,50 @@ inline su2double CNumerics::Determinant_3x3(su2double A00,
   
 }
 
+inline CNumerics *CNumerics::GetThread_Numerics(unsigned short val_thread) {
+  return (Thread_Numerics != NULL)? Thread_Numerics[val_thread] : this;
+}
+
+inline bool CNumerics::GetBatched(void) { return false; }
+
+inline void CNumerics::ComputeResidual_Batch(CNumericsBatch *val_batch, CConfig *config) { }
+
+inline void CNumericsBatch::SetLambda(unsigned short val_lane, su2double val_lambda_i, su2double val_lambda_j) {
+  Lambda_i[val_lane] = val_lambda_i; Lambda_j[val_lane] = val_lambda_j;
+}
+
+inline void CNumericsBatch::SetSensor(unsigned short val_lane, su2double val_sensor_i, su2double val_sensor_j) {
+  Sensor_i[val_lane] = val_sensor_i; Sensor_j[val_lane] = val_sensor_j;
+}
+
+inline void CNumericsBatch::SetNeighbor(unsigned short val_lane, unsigned short val_neighbor_i, unsigned short val_neighbor_j) {
+  Neighbor_i[val_lane] = su2double(val_neighbor_i); Neighbor_j[val_lane] = su2double(val_neighbor_j);
+}
+
+inline void CNumericsBatch::SetTurbKineticEnergy(unsigned short val_lane, su2double val_turb_ke_i, su2double val_turb_ke_j) {
+  TurbKE_i[val_lane] = val_turb_ke_i; TurbKE_j[val_lane] = val_turb_ke_j;
+}
+
+inline void CNumericsBatch::Clear(void) { nEdge = 0; }
+
+inline unsigned short CNumericsBatch::GetnEdge(void) { return nEdge; }
+
+inline unsigned long CNumericsBatch::GetEdge(unsigned short val_lane) { return Edge[val_lane]; }
+
+inline unsigned long CNumericsBatch::GetPoint_i(unsigned short val_lane) { return Point_i[val_lane]; }
+
+inline unsigned long CNumericsBatch::GetPoint_j(unsigned short val_lane) { return Point_j[val_lane]; }
+
+inline bool CUpwRoe_Flow::GetBatched(void) { return (!grid_movement && !roe_low_dissipation); }
+
+inline bool CUpwHLLC_Flow::GetBatched(void) { return !grid_movement; }
+
+inline bool CCentJST_Flow::GetBatched(void) { return !grid_movement; }
+
+inline bool CAvgGrad_Flow::GetBatched(void) { return true; }
+
+inline bool CAvgGradCorrected_Flow::GetBatched(void) { return true; }
+
 inline void CNumerics::Compute_Mass_Matrix(CElement *element_container, CConfig *config) { }
 
 inline void CNumerics::Compute_Dead_Load(CElement *element_container, CConfig *config) { }
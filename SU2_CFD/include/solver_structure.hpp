@@ -41,6 +41,7 @@
 #pragma once
 
 #include "../../Common/include/mpi_structure.hpp"
+#include "../../Common/include/omp_structure.hpp"
 
 #include <cmath>
 #include <string>
@@ -125,6 +126,7 @@ protected:
   int Restart_ExtIter;     /*!< \brief Auxiliary structure for holding the external iteration offset from a restart. */
   passivedouble *Restart_Data; /*!< \brief Auxiliary structure for holding the data values from a restart. */
   unsigned short nOutputVariables;  /*!< \brief Number of variables to write. */
+  bool Periodic_Vectors;  /*!< \brief Whether the entries 1 to nDim of the solution-sized quantities are vectors, rotated across periodic boundaries. */
 
 public:
   
@@ -140,6 +142,7 @@ public:
   
   CVariable** node;  /*!< \brief Vector which the define the variables for each problem. */
   CVariable* node_infty; /*!< \brief CVariable storing the free stream conditions. */
+  CVariableStorage node_storage; /*!< \brief Contiguous storage of the most accessed fields of <i>node</i>. */
   
   /*!
    * \brief Constructor of the class.
@@ -157,6 +160,78 @@ public:
    */
   void SetIterLinSolver(unsigned short val_iterlinsolver);
   
+  /*!
+   * \brief Move the fields of all the variables into the contiguous <i>node_storage</i>.
+   *        Must be called once, after all the variables of the solver have been created.
+   * \param[in] val_nprimvar - Number of primitive variables per point (0 if none).
+   * \param[in] val_nprimvargrad - Number of primitive variables with gradient per point (0 if none).
+   * \param[in] val_nsecondaryvar - Number of secondary variables per point (0 if none).
+   */
+  void SetVariable_Storage(unsigned short val_nprimvar, unsigned short val_nprimvargrad, unsigned short val_nsecondaryvar);
+  
+  /*!
+   * \brief Number of values per point exchanged for a quantity in the halo communications.
+   * \param[in] commType - Quantity to be exchanged (ENUM_MPI_QUANTITIES).
+   * \return Number of values per point.
+   */
+  unsigned short GetComms_CountPerPoint(unsigned short commType);
+  
+  /*!
+   * \brief Start the halo exchange of a quantity: post the receives, pack the send buffer and post the sends.
+   *        Work that does not involve the halo points can be done before calling CompleteComms.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] commType - Quantity to be exchanged (ENUM_MPI_QUANTITIES).
+   */
+  void InitiateComms(CGeometry *geometry, CConfig *config, unsigned short commType);
+  
+  /*!
+   * \brief Finish the halo exchange of a quantity: unpack each message as it arrives, applying the
+   *        periodic rotation, and wait for the sends.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] commType - Quantity to be exchanged (ENUM_MPI_QUANTITIES).
+   */
+  void CompleteComms(CGeometry *geometry, CConfig *config, unsigned short commType);
+  
+  /*!
+   * \brief Start the halo exchange of several quantities, packed in a single message per neighbor.
+   *        Only the quantities needed by the active numerics should be requested.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_nComm - Number of quantities to be exchanged.
+   * \param[in] val_commType - Quantities to be exchanged (ENUM_MPI_QUANTITIES).
+   */
+  void InitiateComms(CGeometry *geometry, CConfig *config, unsigned short val_nComm, const unsigned short *val_commType);
+  
+  /*!
+   * \brief Finish the halo exchange of several quantities, the list must be the one given to InitiateComms.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_nComm - Number of quantities to be exchanged.
+   * \param[in] val_commType - Quantities to be exchanged (ENUM_MPI_QUANTITIES).
+   */
+  void CompleteComms(CGeometry *geometry, CConfig *config, unsigned short val_nComm, const unsigned short *val_commType);
+  
+  /*!
+   * \brief Copy the values of a quantity at a point into a send buffer.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] commType - Quantity to be exchanged (ENUM_MPI_QUANTITIES).
+   * \param[in] iPoint - Index of the point.
+   * \param[out] buf - Position of the point in the send buffer.
+   */
+  void PackComms_Point(CGeometry *geometry, unsigned short commType, unsigned long iPoint, su2double *buf);
+  
+  /*!
+   * \brief Apply the periodic rotation to the received values of a quantity and store them at a (halo) point.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] commType - Quantity to be exchanged (ENUM_MPI_QUANTITIES).
+   * \param[in] iPoint - Index of the point.
+   * \param[in] rotMatrix - Periodic rotation matrix of the point.
+   * \param[in,out] buf - Position of the point in the receive buffer.
+   */
+  void UnpackComms_Point(CGeometry *geometry, unsigned short commType, unsigned long iPoint, const su2double *rotMatrix, su2double *buf);
+  
   /*!
    * \brief Set number of linear solver iterations.
    * \param[in] val_iterlinsolver - Number of linear iterations.
@@ -4490,6 +4565,8 @@ protected:
   su2double ****SlidingState;
   int **SlidingStateNodes;
 
+  bool Fused_Limiter_Bounds;  /*!< \brief Whether the next primitive gradient computation also accumulates the neighbor bounds of the limiter (consumed by SetPrimitive_Limiter). */
+
 public:
   
   
@@ -4643,6 +4720,18 @@ public:
   void Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                        CConfig *config, unsigned short iMesh);
   
+  /*!
+   * \brief Compute the fluxes of a pack of edges and update the residual and the Jacobian.
+   * \param[in] numerics - Description of the numerical method (of the thread).
+   * \param[in] batch - Pack of edges, it is empty on exit.
+   * \param[in] val_residual - Auxiliary vector for the residual of an edge.
+   * \param[in] implicit - Update the Jacobian.
+   * \param[in] viscous - Viscous fluxes, subtracted from point i and added to point j.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Batch_Residual(CNumerics *numerics, CNumericsBatch *batch, su2double *val_residual,
+                      bool implicit, bool viscous, CConfig *config);
+  
   /*!
    * \brief Compute the extrapolated quantities, for MUSCL upwind 2nd reconstruction,
    * in a more thermodynamic consistent way
@@ -4751,7 +4840,8 @@ public:
   void Set_MPI_Primitive_Gradient(CGeometry *geometry, CConfig *config);
   
   /*!
-   * \brief Compute the limiter of the primitive variables.
+   * \brief Compute the limiter of the primitive variables, the neighbor bounds are
+   *        reused if they were accumulated by the gradient computation.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    */
@@ -51,6 +51,112 @@
 
 using namespace std;
 
+/*!
+ * \class CVariableStorage
+ * \brief Contiguous, point-major storage of the most accessed solution fields.
+ *
+ * The solvers keep one CVariable per point, which scatters the data of consecutive
+ * points across the heap. The variables can be relocated into this container so that
+ * the edge and point loops read the solution, primitive, secondary, gradient and limiter
+ * fields in memory order. The CVariable accessors keep working on the same memory.
+ */
+class CVariableStorage {
+private:
+  unsigned long nPoint;             /*!< \brief Number of points stored. */
+  unsigned short nDim,              /*!< \brief Number of dimensions of the problem. */
+  nVar,                             /*!< \brief Number of solution variables per point. */
+  nPrimVar,                         /*!< \brief Number of primitive variables per point. */
+  nPrimVarGrad,                     /*!< \brief Number of primitive variables with gradient per point. */
+  nSecondaryVar;                    /*!< \brief Number of secondary variables per point. */
+  su2double *Solution,              /*!< \brief Solution, nPoint x nVar. */
+  *Gradient,                        /*!< \brief Gradient of the solution, nPoint x nVar x nDim. */
+  *Limiter,                         /*!< \brief Limiter of the solution, nPoint x nVar. */
+  *Primitive,                       /*!< \brief Primitive variables, nPoint x nPrimVar. */
+  *Gradient_Primitive,              /*!< \brief Gradient of the primitive variables, nPoint x nPrimVarGrad x nDim. */
+  *Limiter_Primitive,               /*!< \brief Limiter of the primitive variables, nPoint x nPrimVarGrad. */
+  *Secondary;                       /*!< \brief Secondary variables, nPoint x nSecondaryVar. */
+
+public:
+
+  /*!
+   * \brief Constructor of the class.
+   */
+  CVariableStorage(void);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CVariableStorage(void);
+
+  /*!
+   * \brief Allocate the contiguous arrays, fields with zero size are not allocated.
+   * \param[in] val_npoint - Number of points.
+   * \param[in] val_ndim - Number of dimensions of the problem.
+   * \param[in] val_nvar - Number of solution variables.
+   * \param[in] val_nprimvar - Number of primitive variables.
+   * \param[in] val_nprimvargrad - Number of primitive variables with gradient.
+   * \param[in] val_nsecondaryvar - Number of secondary variables.
+   */
+  void Initialize(unsigned long val_npoint, unsigned short val_ndim, unsigned short val_nvar,
+                  unsigned short val_nprimvar, unsigned short val_nprimvargrad, unsigned short val_nsecondaryvar);
+
+  /*!
+   * \brief Check if the arrays have been allocated.
+   * \return <code>TRUE</code> if the container holds data.
+   */
+  bool IsAllocated(void);
+
+  /*!
+   * \brief Get the solution of a point.
+   * \param[in] iPoint - Index of the point.
+   * \return Pointer to the nVar solution values (NULL if not allocated).
+   */
+  su2double *GetSolution(unsigned long iPoint);
+
+  /*!
+   * \brief Get the gradient of the solution of a point.
+   * \param[in] iPoint - Index of the point.
+   * \return Pointer to the nVar x nDim gradient values, stored row by row.
+   */
+  su2double *GetGradient(unsigned long iPoint);
+
+  /*!
+   * \brief Get the limiter of the solution of a point.
+   * \param[in] iPoint - Index of the point.
+   * \return Pointer to the nVar limiter values.
+   */
+  su2double *GetLimiter(unsigned long iPoint);
+
+  /*!
+   * \brief Get the primitive variables of a point.
+   * \param[in] iPoint - Index of the point.
+   * \return Pointer to the nPrimVar primitive variables.
+   */
+  su2double *GetPrimitive(unsigned long iPoint);
+
+  /*!
+   * \brief Get the gradient of the primitive variables of a point.
+   * \param[in] iPoint - Index of the point.
+   * \return Pointer to the nPrimVarGrad x nDim gradient values, stored row by row.
+   */
+  su2double *GetGradient_Primitive(unsigned long iPoint);
+
+  /*!
+   * \brief Get the limiter of the primitive variables of a point.
+   * \param[in] iPoint - Index of the point.
+   * \return Pointer to the nPrimVarGrad limiter values.
+   */
+  su2double *GetLimiter_Primitive(unsigned long iPoint);
+
+  /*!
+   * \brief Get the secondary variables of a point.
+   * \param[in] iPoint - Index of the point.
+   * \return Pointer to the nSecondaryVar secondary variables.
+   */
+  su2double *GetSecondary(unsigned long iPoint);
+
+};
+
 /*!
  * \class CVariable
  * \brief Main class for defining the variables.
@@ -91,6 +197,7 @@ protected:
                                                        note that this variable cannnot be static, it is possible to
                                                        have different number of nVar in the same problem. */
   su2double *Solution_Adj_Old;    /*!< \brief Solution of the problem in the previous AD-BGS iteration. */
+  bool Shared_Storage;    /*!< \brief The fields relocated to a CVariableStorage are not owned by the variable. */
   
 public:
   
@@ -119,6 +226,14 @@ public:
    */
   virtual ~CVariable(void);
   
+  /*!
+   * \brief Move the solution, gradient and limiter of the point into a contiguous container,
+   *        the current values are preserved.
+   * \param[in] storage - Container shared by all the points of the solver.
+   * \param[in] iPoint - Index of the point that owns this variable.
+   */
+  virtual void SetStorage(CVariableStorage *storage, unsigned long iPoint);
+  
   /*!
    * \brief Set the value of the solution.
    * \param[in] val_solution - Solution of the problem.
@@ -3200,6 +3315,14 @@ public:
    * \brief Destructor of the class.
    */
   virtual ~CEulerVariable(void);
+  
+  /*!
+   * \brief Move the solution, primitive and secondary variables of the point, and their gradients
+   *        and limiters, into a contiguous container.
+   * \param[in] storage - Container shared by all the points of the solver.
+   * \param[in] iPoint - Index of the point that owns this variable.
+   */
+  void SetStorage(CVariableStorage *storage, unsigned long iPoint);
 
   /*!
    * \brief Get the new solution of the problem (Classical RK4).
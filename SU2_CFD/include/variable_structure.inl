@@ -37,6 +37,22 @@
 
 #pragma once
 
+inline bool CVariableStorage::IsAllocated(void) { return (nPoint > 0); }
+
+inline su2double *CVariableStorage::GetSolution(unsigned long iPoint) { return (Solution != NULL)? &Solution[iPoint*nVar] : NULL; }
+
+inline su2double *CVariableStorage::GetGradient(unsigned long iPoint) { return (Gradient != NULL)? &Gradient[iPoint*nVar*nDim] : NULL; }
+
+inline su2double *CVariableStorage::GetLimiter(unsigned long iPoint) { return (Limiter != NULL)? &Limiter[iPoint*nVar] : NULL; }
+
+inline su2double *CVariableStorage::GetPrimitive(unsigned long iPoint) { return (Primitive != NULL)? &Primitive[iPoint*nPrimVar] : NULL; }
+
+inline su2double *CVariableStorage::GetGradient_Primitive(unsigned long iPoint) { return (Gradient_Primitive != NULL)? &Gradient_Primitive[iPoint*nPrimVarGrad*nDim] : NULL; }
+
+inline su2double *CVariableStorage::GetLimiter_Primitive(unsigned long iPoint) { return (Limiter_Primitive != NULL)? &Limiter_Primitive[iPoint*nPrimVarGrad] : NULL; }
+
+inline su2double *CVariableStorage::GetSecondary(unsigned long iPoint) { return (Secondary != NULL)? &Secondary[iPoint*nSecondaryVar] : NULL; }
+
 inline bool CVariable::SetDensity(void) { return 0; }
 
 inline void CVariable::SetDensity(su2double val_density){ }
@@ -320,6 +320,12 @@ CDriver::CDriver(char* confFile,
     Numerics_Preprocessing(numerics_container[iZone], solver_container[iZone],
         geometry_container[iZone], config_container[iZone]);
 
+    /*--- Copies of the numerics for the threaded edge loops ---*/
+
+    if (OMP::GetMaxThreads() > 1)
+      Numerics_Thread_Preprocessing(numerics_container[iZone], solver_container[iZone],
+                                    geometry_container[iZone], config_container[iZone]);
+
     if (rank == MASTER_NODE) cout << "Numerics Preprocessing." << endl;
 
   }
@@ -765,6 +771,19 @@ void CDriver::Geometrical_Preprocessing() {
 
   }
 
+  /*--- Store the dual grid data (coordinates, volumes, wall distance,
+   edge nodes and normals) in contiguous arrays for all the grid levels,
+   color the edges for the threaded edge loops and build the halo
+   communications of the SEND_RECEIVE markers. ---*/
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    for (iMGlevel = 0; iMGlevel <= config_container[iZone]->GetnMGLevels(); iMGlevel++) {
+      geometry_container[iZone][iMGlevel]->SetDualGrid_Storage(config_container[iZone]);
+      geometry_container[iZone][iMGlevel]->SetEdge_Coloring(OMP::GetMaxThreads());
+      geometry_container[iZone][iMGlevel]->PreprocessP2PComms(config_container[iZone]);
+    }
+  }
+
   /*--- For unsteady simulations, initialize the grid volumes
    and coordinates for previous solutions. Loop over all zones/grids ---*/
 
@@ -1316,7 +1335,7 @@ void CDriver::Numerics_Preprocessing(CNumerics ****numerics_container,
                                      CSolver ***solver_container, CGeometry **geometry,
                                      CConfig *config) {
   
-  unsigned short iMGlevel, iSol, nDim,
+  unsigned short iMGlevel, iSol, iTerm, nDim,
   
   nVar_Template         = 0,
   nVar_Flow             = 0,
@@ -1427,8 +1446,11 @@ void CDriver::Numerics_Preprocessing(CNumerics ****numerics_container,
   else{
     for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
       numerics_container[iMGlevel] = new CNumerics** [MAX_SOLS];
-      for (iSol = 0; iSol < MAX_SOLS; iSol++)
+      for (iSol = 0; iSol < MAX_SOLS; iSol++) {
         numerics_container[iMGlevel][iSol] = new CNumerics* [MAX_TERMS];
+        for (iTerm = 0; iTerm < MAX_TERMS; iTerm++)
+          numerics_container[iMGlevel][iSol][iTerm] = NULL;
+      }
     }
   }
   
@@ -2137,6 +2159,43 @@ void CDriver::Numerics_Preprocessing(CNumerics ****numerics_container,
 
 }
 
+void CDriver::Numerics_Thread_Preprocessing(CNumerics ****numerics_container,
+                                            CSolver ***solver_container, CGeometry **geometry,
+                                            CConfig *config) {
+
+  unsigned short iMGlevel, iSol, iTerm, iThread, nThread = OMP::GetMaxThreads();
+  CNumerics ****numerics_thread;
+
+  /*--- Only the finite volume solvers have threaded edge loops ---*/
+
+  if ((config->GetKind_Solver() == FEM_ELASTICITY) || (config->GetKind_Solver() == DISC_ADJ_FEM)) return;
+
+  numerics_thread = new CNumerics***[config->GetnMGLevels()+1];
+
+  for (iThread = 1; iThread < nThread; iThread++) {
+
+    /*--- Build a complete new set of numerics and hand each one to its
+     counterpart in the main container, which takes ownership of it. ---*/
+
+    Numerics_Preprocessing(numerics_thread, solver_container, geometry, config);
+
+    for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
+      for (iSol = 0; iSol < MAX_SOLS; iSol++) {
+        for (iTerm = 0; iTerm < MAX_TERMS; iTerm++) {
+          if (numerics_container[iMGlevel][iSol][iTerm] != NULL)
+            numerics_container[iMGlevel][iSol][iTerm]->SetThread_Numerics(nThread, iThread, numerics_thread[iMGlevel][iSol][iTerm]);
+        }
+        delete [] numerics_thread[iMGlevel][iSol];
+      }
+      delete [] numerics_thread[iMGlevel];
+    }
+
+  }
+
+  delete [] numerics_thread;
+
+}
+
 void CDriver::Numerics_Postprocessing(CNumerics ****numerics_container,
                                       CSolver ***solver_container, CGeometry **geometry,
                                       CConfig *config) {
@@ -232,6 +232,150 @@ void CCentJST_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jac
   AD::EndPreacc();
 }
 
+void CCentJST_Flow::ComputeResidual_Batch(CNumericsBatch *val_batch, CConfig *config) {
+  
+  unsigned short iLane;
+  su2double *V_i = val_batch->V_i, *V_j = val_batch->V_j, *Normal = val_batch->Normal,
+  *Und_Lapl_i = val_batch->Und_Lapl_i, *Und_Lapl_j = val_batch->Und_Lapl_j,
+  *Residual = val_batch->Residual, *Jacobian_i = val_batch->Jacobian_i, *Jacobian_j = val_batch->Jacobian_j;
+  
+  su2double U_i[5*BATCH_SIZE], U_j[5*BATCH_SIZE], Vel_i[3*BATCH_SIZE], Vel_j[3*BATCH_SIZE], MeanVel[3*BATCH_SIZE],
+  SqVel_i[BATCH_SIZE], SqVel_j[BATCH_SIZE], MeanRho[BATCH_SIZE], MeanP[BATCH_SIZE], MeanH[BATCH_SIZE], MeanE[BATCH_SIZE],
+  ProjVel_i[BATCH_SIZE], ProjVel_j[BATCH_SIZE], Area_Lane[BATCH_SIZE], Eps_2[BATCH_SIZE], Eps_4[BATCH_SIZE],
+  Stretching[BATCH_SIZE], Lambda_Mean[BATCH_SIZE], Cte_0[BATCH_SIZE], Cte_1[BATCH_SIZE], *Jac;
+  su2double Rho_i, Rho_j, E_i, E_j, Lambda_Loc_i, Lambda_Loc_j, Phi_Loc_i, Phi_Loc_j, Sc2, Sc4;
+  
+  /*--- Same operations as ComputeResidual (fixed grids), each loop
+   is over the lanes of the pack so that it can be vectorized ---*/
+  
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    SqVel_i[iLane] = 0.0; SqVel_j[iLane] = 0.0;
+  }
+  for (iDim = 0; iDim < nDim; iDim++) {
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+      Vel_i[iDim*BATCH_SIZE+iLane] = V_i[(iDim+1)*BATCH_SIZE+iLane];
+      Vel_j[iDim*BATCH_SIZE+iLane] = V_j[(iDim+1)*BATCH_SIZE+iLane];
+      SqVel_i[iLane] += 0.5*Vel_i[iDim*BATCH_SIZE+iLane]*Vel_i[iDim*BATCH_SIZE+iLane];
+      SqVel_j[iLane] += 0.5*Vel_j[iDim*BATCH_SIZE+iLane]*Vel_j[iDim*BATCH_SIZE+iLane];
+    }
+  }
+  
+  /*--- Recompute conservative variables and the mean values ---*/
+  
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    Rho_i = V_i[(nDim+2)*BATCH_SIZE+iLane]; Rho_j = V_j[(nDim+2)*BATCH_SIZE+iLane];
+    E_i = V_i[(nDim+3)*BATCH_SIZE+iLane] - V_i[(nDim+1)*BATCH_SIZE+iLane]/Rho_i;
+    E_j = V_j[(nDim+3)*BATCH_SIZE+iLane] - V_j[(nDim+1)*BATCH_SIZE+iLane]/Rho_j;
+    U_i[iLane] = Rho_i; U_j[iLane] = Rho_j;
+    U_i[(nDim+1)*BATCH_SIZE+iLane] = Rho_i*E_i; U_j[(nDim+1)*BATCH_SIZE+iLane] = Rho_j*E_j;
+    MeanRho[iLane] = 0.5*(Rho_i+Rho_j);
+    MeanP[iLane] = 0.5*(V_i[(nDim+1)*BATCH_SIZE+iLane]+V_j[(nDim+1)*BATCH_SIZE+iLane]);
+    MeanH[iLane] = 0.5*(V_i[(nDim+3)*BATCH_SIZE+iLane]+V_j[(nDim+3)*BATCH_SIZE+iLane]);
+    MeanE[iLane] = 0.5*(E_i+E_j);
+  }
+  for (iDim = 0; iDim < nDim; iDim++) {
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+      U_i[(iDim+1)*BATCH_SIZE+iLane] = U_i[iLane]*Vel_i[iDim*BATCH_SIZE+iLane];
+      U_j[(iDim+1)*BATCH_SIZE+iLane] = U_j[iLane]*Vel_j[iDim*BATCH_SIZE+iLane];
+      MeanVel[iDim*BATCH_SIZE+iLane] = 0.5*(Vel_i[iDim*BATCH_SIZE+iLane]+Vel_j[iDim*BATCH_SIZE+iLane]);
+    }
+  }
+  
+  /*--- Residual and Jacobians of the inviscid flux ---*/
+  
+  GetInviscidProjFlux_Batch(MeanRho, MeanVel, MeanP, MeanH, Normal, Residual);
+  
+  if (implicit) {
+    GetInviscidProjJac_Batch(MeanVel, MeanE, Normal, 0.5, Jacobian_i);
+    for (iVar = 0; iVar < nVar*nVar*BATCH_SIZE; iVar++)
+      Jacobian_j[iVar] = Jacobian_i[iVar];
+  }
+  
+  /*--- Local spectral radius, stretching factor and dissipation coefficients ---*/
+  
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    ProjVel_i[iLane] = 0.0; ProjVel_j[iLane] = 0.0; Area_Lane[iLane] = 0.0;
+  }
+  for (iDim = 0; iDim < nDim; iDim++) {
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+      ProjVel_i[iLane] += Vel_i[iDim*BATCH_SIZE+iLane]*Normal[iDim*BATCH_SIZE+iLane];
+      ProjVel_j[iLane] += Vel_j[iDim*BATCH_SIZE+iLane]*Normal[iDim*BATCH_SIZE+iLane];
+      Area_Lane[iLane] += Normal[iDim*BATCH_SIZE+iLane]*Normal[iDim*BATCH_SIZE+iLane];
+    }
+  }
+  
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    
+    Area_Lane[iLane] = sqrt(Area_Lane[iLane]);
+    
+    Lambda_Loc_i = (fabs(ProjVel_i[iLane])+V_i[(nDim+4)*BATCH_SIZE+iLane]*Area_Lane[iLane]);
+    Lambda_Loc_j = (fabs(ProjVel_j[iLane])+V_j[(nDim+4)*BATCH_SIZE+iLane]*Area_Lane[iLane]);
+    Lambda_Mean[iLane] = 0.5*(Lambda_Loc_i+Lambda_Loc_j);
+    
+    Phi_Loc_i = pow(val_batch->Lambda_i[iLane]/(4.0*Lambda_Mean[iLane]), Param_p);
+    Phi_Loc_j = pow(val_batch->Lambda_j[iLane]/(4.0*Lambda_Mean[iLane]), Param_p);
+    Stretching[iLane] = 4.0*Phi_Loc_i*Phi_Loc_j/(Phi_Loc_i+Phi_Loc_j);
+    
+    Sc2 = 3.0*(val_batch->Neighbor_i[iLane]+val_batch->Neighbor_j[iLane])/(val_batch->Neighbor_i[iLane]*val_batch->Neighbor_j[iLane]);
+    Sc4 = Sc2*Sc2/4.0;
+    
+    Eps_2[iLane] = Param_Kappa_2*0.5*(val_batch->Sensor_i[iLane]+val_batch->Sensor_j[iLane])*Sc2;
+    Eps_4[iLane] = max(0.0, Param_Kappa_4-Eps_2[iLane])*Sc4;
+    
+    Cte_0[iLane] = (Eps_2[iLane] + Eps_4[iLane]*(val_batch->Neighbor_i[iLane]+1.0))*Stretching[iLane]*Lambda_Mean[iLane];
+    Cte_1[iLane] = (Eps_2[iLane] + Eps_4[iLane]*(val_batch->Neighbor_j[iLane]+1.0))*Stretching[iLane]*Lambda_Mean[iLane];
+  }
+  
+  /*--- Artificial dissipation, the difference of the energies is
+   replaced by the difference of rho*H ---*/
+  
+  for (iVar = 0; iVar < nVar-1; iVar++) {
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Residual[iVar*BATCH_SIZE+iLane] += (Eps_2[iLane]*(U_i[iVar*BATCH_SIZE+iLane]-U_j[iVar*BATCH_SIZE+iLane]) -
+                                          Eps_4[iLane]*(Und_Lapl_i[iVar*BATCH_SIZE+iLane]-Und_Lapl_j[iVar*BATCH_SIZE+iLane]))*
+                                         Stretching[iLane]*Lambda_Mean[iLane];
+  }
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+    Residual[(nVar-1)*BATCH_SIZE+iLane] += (Eps_2[iLane]*(V_i[(nDim+2)*BATCH_SIZE+iLane]*V_i[(nDim+3)*BATCH_SIZE+iLane]-
+                                                          V_j[(nDim+2)*BATCH_SIZE+iLane]*V_j[(nDim+3)*BATCH_SIZE+iLane]) -
+                                            Eps_4[iLane]*(Und_Lapl_i[(nVar-1)*BATCH_SIZE+iLane]-Und_Lapl_j[(nVar-1)*BATCH_SIZE+iLane]))*
+                                           Stretching[iLane]*Lambda_Mean[iLane];
+  
+  /*--- Jacobian of the artificial dissipation ---*/
+  
+  if (implicit) {
+    
+    for (iVar = 0; iVar < nVar-1; iVar++) {
+      for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+        Jacobian_i[(iVar*nVar+iVar)*BATCH_SIZE+iLane] += Cte_0[iLane];
+        Jacobian_j[(iVar*nVar+iVar)*BATCH_SIZE+iLane] -= Cte_1[iLane];
+      }
+    }
+    
+    /*--- Last rows of Jacobian_i and Jacobian_j ---*/
+    
+    Jac = &Jacobian_i[(nVar-1)*nVar*BATCH_SIZE];
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Jac[iLane] += Cte_0[iLane]*Gamma_Minus_One*SqVel_i[iLane];
+    for (iDim = 0; iDim < nDim; iDim++)
+      for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+        Jac[(iDim+1)*BATCH_SIZE+iLane] -= Cte_0[iLane]*Gamma_Minus_One*Vel_i[iDim*BATCH_SIZE+iLane];
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Jac[(nVar-1)*BATCH_SIZE+iLane] += Cte_0[iLane]*Gamma;
+    
+    Jac = &Jacobian_j[(nVar-1)*nVar*BATCH_SIZE];
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Jac[iLane] -= Cte_1[iLane]*Gamma_Minus_One*SqVel_j[iLane];
+    for (iDim = 0; iDim < nDim; iDim++)
+      for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+        Jac[(iDim+1)*BATCH_SIZE+iLane] += Cte_1[iLane]*Gamma_Minus_One*Vel_j[iDim*BATCH_SIZE+iLane];
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Jac[(nVar-1)*BATCH_SIZE+iLane] -= Cte_1[iLane]*Gamma;
+    
+  }
+  
+}
+
 CCentJST_KE_Flow::CCentJST_KE_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) : CNumerics(val_nDim, val_nVar, config) {
 
   implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
@@ -1858,6 +2002,277 @@ if (sM > 0.0) {
 
 }
 
+void CUpwHLLC_Flow::ComputeResidual_Batch(CNumericsBatch *val_batch, CConfig *config) {
+  
+  unsigned short iLane, iDim_Lane;
+  su2double *V_i = val_batch->V_i, *V_j = val_batch->V_j, *Normal = val_batch->Normal,
+  *Residual = val_batch->Residual, *Jacobian_i = val_batch->Jacobian_i, *Jacobian_j = val_batch->Jacobian_j;
+  
+  su2double Unit_Normal[3*BATCH_SIZE], Vel_i[3*BATCH_SIZE], Vel_j[3*BATCH_SIZE], Vel_o[3*BATCH_SIZE], Vel_x[3*BATCH_SIZE],
+  Area_Lane[BATCH_SIZE], Rho_i[BATCH_SIZE], Rho_j[BATCH_SIZE], P_i[BATCH_SIZE], P_j[BATCH_SIZE], H_i[BATCH_SIZE], H_j[BATCH_SIZE],
+  E_o[BATCH_SIZE], Sq_i[BATCH_SIZE], Sq_j[BATCH_SIZE], ProjVel_i[BATCH_SIZE], ProjVel_j[BATCH_SIZE], RoeVel[BATCH_SIZE],
+  SqVel_Roe[BATCH_SIZE], ProjVel_Roe[BATCH_SIZE], Speed_L[BATCH_SIZE], Speed_R[BATCH_SIZE], Speed_M[BATCH_SIZE],
+  Rho_Star[BATCH_SIZE], P_Star[BATCH_SIZE], E_Star[BATCH_SIZE], Omega_Lane[BATCH_SIZE], OmegaSM_Lane[BATCH_SIZE],
+  Sign[BATCH_SIZE], Rho_o[BATCH_SIZE], Rho_x[BATCH_SIZE], P_o[BATCH_SIZE], H_o[BATCH_SIZE], Sq_o[BATCH_SIZE], Sq_x[BATCH_SIZE],
+  ProjVel_o[BATCH_SIZE], ProjVel_x[BATCH_SIZE], S_o[BATCH_SIZE], S_x[BATCH_SIZE], Area_Kappa[BATCH_SIZE],
+  State[5*BATCH_SIZE], Flux_Phys[5*BATCH_SIZE], dSm[5*BATCH_SIZE], dPI[5*BATCH_SIZE], drhoStar[5*BATCH_SIZE],
+  dpStar[5*BATCH_SIZE], dEStar[5*BATCH_SIZE], Jac_Own[5*5*BATCH_SIZE], Jac_Other[5*5*BATCH_SIZE], Jac_Phys[5*5*BATCH_SIZE];
+  su2double SoundSpeed_Roe, SoundSpeed_i_Lane, SoundSpeed_j_Lane, Enthalpy_Roe, Rho_S, Sqrt_Rho_i, Sqrt_Rho_j, *Jac;
+  bool Left[BATCH_SIZE], Supersonic[BATCH_SIZE];
+  
+  /*--- Same operations as ComputeResidual (fixed grids), each loop is over the
+   lanes of the pack so that it can be vectorized. The branches of the scalar
+   version are written for the upwind side "o" of each lane (i if sM > 0,
+   j otherwise) and the other side "x", the results are then selected per lane ---*/
+  
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    Area_Lane[iLane] = 0.0; Sq_i[iLane] = 0.0; Sq_j[iLane] = 0.0;
+    ProjVel_i[iLane] = 0; ProjVel_j[iLane] = 0;
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Area_Lane[iLane] += Normal[iDim*BATCH_SIZE+iLane] * Normal[iDim*BATCH_SIZE+iLane];
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+    Area_Lane[iLane] = sqrt(Area_Lane[iLane]);
+  
+  for (iDim = 0; iDim < nDim; iDim++) {
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+      Unit_Normal[iDim*BATCH_SIZE+iLane] = Normal[iDim*BATCH_SIZE+iLane] / Area_Lane[iLane];
+      Vel_i[iDim*BATCH_SIZE+iLane] = V_i[(iDim+1)*BATCH_SIZE+iLane];
+      Vel_j[iDim*BATCH_SIZE+iLane] = V_j[(iDim+1)*BATCH_SIZE+iLane];
+      Sq_i[iLane] += Vel_i[iDim*BATCH_SIZE+iLane] * Vel_i[iDim*BATCH_SIZE+iLane];
+      Sq_j[iLane] += Vel_j[iDim*BATCH_SIZE+iLane] * Vel_j[iDim*BATCH_SIZE+iLane];
+    }
+  }
+  for (iDim = 0; iDim < nDim; iDim++) {
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+      ProjVel_i[iLane] += Vel_i[iDim*BATCH_SIZE+iLane] * Unit_Normal[iDim*BATCH_SIZE+iLane];
+      ProjVel_j[iLane] += Vel_j[iDim*BATCH_SIZE+iLane] * Unit_Normal[iDim*BATCH_SIZE+iLane];
+    }
+  }
+  
+  /*--- Roe's averaging ---*/
+  
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    P_i[iLane] = V_i[(nDim+1)*BATCH_SIZE+iLane];   P_j[iLane] = V_j[(nDim+1)*BATCH_SIZE+iLane];
+    Rho_i[iLane] = V_i[(nDim+2)*BATCH_SIZE+iLane]; Rho_j[iLane] = V_j[(nDim+2)*BATCH_SIZE+iLane];
+    H_i[iLane] = V_i[(nDim+3)*BATCH_SIZE+iLane];   H_j[iLane] = V_j[(nDim+3)*BATCH_SIZE+iLane];
+    SqVel_Roe[iLane] = 0.0; ProjVel_Roe[iLane] = 0.0;
+  }
+  for (iDim = 0; iDim < nDim; iDim++) {
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+      Sqrt_Rho_i = sqrt(Rho_i[iLane]); Sqrt_Rho_j = sqrt(Rho_j[iLane]);
+      RoeVel[iLane] = ( Vel_i[iDim*BATCH_SIZE+iLane] * Sqrt_Rho_i + Vel_j[iDim*BATCH_SIZE+iLane] * Sqrt_Rho_j ) / ( Sqrt_Rho_i + Sqrt_Rho_j );
+      SqVel_Roe[iLane] += RoeVel[iLane] * RoeVel[iLane];
+      ProjVel_Roe[iLane] += RoeVel[iLane] * Unit_Normal[iDim*BATCH_SIZE+iLane];
+    }
+  }
+  
+  /*--- Wave speeds, speed of the contact surface and pressure of the star states ---*/
+  
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    
+    Sqrt_Rho_i = sqrt(Rho_i[iLane]); Sqrt_Rho_j = sqrt(Rho_j[iLane]);
+    Enthalpy_Roe = ( Sqrt_Rho_j * H_j[iLane] + Sqrt_Rho_i * H_i[iLane] ) / ( Sqrt_Rho_i + Sqrt_Rho_j );
+    SoundSpeed_Roe = sqrt( Gamma_Minus_One * ( Enthalpy_Roe - 0.5 * SqVel_Roe[iLane] ) );
+    SoundSpeed_i_Lane = sqrt( (H_i[iLane] - 0.5 * Sq_i[iLane]) * Gamma_Minus_One );
+    SoundSpeed_j_Lane = sqrt( (H_j[iLane] - 0.5 * Sq_j[iLane]) * Gamma_Minus_One );
+    
+    Speed_L[iLane] = min( ProjVel_Roe[iLane] - SoundSpeed_Roe, ProjVel_i[iLane] - SoundSpeed_i_Lane);
+    Speed_R[iLane] = max( ProjVel_Roe[iLane] + SoundSpeed_Roe, ProjVel_j[iLane] + SoundSpeed_j_Lane);
+    
+    Rho_Star[iLane] = Rho_j[iLane] * (Speed_R[iLane] - ProjVel_j[iLane]) - Rho_i[iLane] * (Speed_L[iLane] - ProjVel_i[iLane]);
+    Speed_M[iLane] = ( P_i[iLane] - P_j[iLane] - Rho_i[iLane] * ProjVel_i[iLane] * ( Speed_L[iLane] - ProjVel_i[iLane] ) +
+                       Rho_j[iLane] * ProjVel_j[iLane] * ( Speed_R[iLane] - ProjVel_j[iLane] ) ) / Rho_Star[iLane];
+    P_Star[iLane] = Rho_j[iLane] * ( ProjVel_j[iLane] - Speed_R[iLane] ) * ( ProjVel_j[iLane] - Speed_M[iLane] ) + P_j[iLane];
+    
+    /*--- Upwind side of the lane ---*/
+    
+    Left[iLane] = (Speed_M[iLane] > 0.0);
+    Supersonic[iLane] = Left[iLane]? (Speed_L[iLane] > 0.0) : (Speed_R[iLane] < 0.0);
+    Sign[iLane] = Left[iLane]? 1.0 : -1.0;
+    
+    Rho_o[iLane] = Left[iLane]? Rho_i[iLane] : Rho_j[iLane];     Rho_x[iLane] = Left[iLane]? Rho_j[iLane] : Rho_i[iLane];
+    P_o[iLane] = Left[iLane]? P_i[iLane] : P_j[iLane];
+    H_o[iLane] = Left[iLane]? H_i[iLane] : H_j[iLane];
+    Sq_o[iLane] = Left[iLane]? Sq_i[iLane] : Sq_j[iLane];         Sq_x[iLane] = Left[iLane]? Sq_j[iLane] : Sq_i[iLane];
+    ProjVel_o[iLane] = Left[iLane]? ProjVel_i[iLane] : ProjVel_j[iLane];
+    ProjVel_x[iLane] = Left[iLane]? ProjVel_j[iLane] : ProjVel_i[iLane];
+    S_o[iLane] = Left[iLane]? Speed_L[iLane] : Speed_R[iLane];   S_x[iLane] = Left[iLane]? Speed_R[iLane] : Speed_L[iLane];
+    E_o[iLane] = H_o[iLane] - P_o[iLane] / Rho_o[iLane];
+    Area_Kappa[iLane] = Area_Lane[iLane]*kappa;
+  }
+  
+  for (iDim = 0; iDim < nDim; iDim++) {
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+      Vel_o[iDim*BATCH_SIZE+iLane] = Left[iLane]? Vel_i[iDim*BATCH_SIZE+iLane] : Vel_j[iDim*BATCH_SIZE+iLane];
+      Vel_x[iDim*BATCH_SIZE+iLane] = Left[iLane]? Vel_j[iDim*BATCH_SIZE+iLane] : Vel_i[iDim*BATCH_SIZE+iLane];
+    }
+  }
+  
+  /*--- Physical flux and star state of the upwind side ---*/
+  
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    Flux_Phys[iLane] = Rho_o[iLane] * ProjVel_o[iLane];
+    Flux_Phys[(nVar-1)*BATCH_SIZE+iLane] = H_o[iLane] * Rho_o[iLane] * ProjVel_o[iLane];
+    Rho_S = ( S_o[iLane] - ProjVel_o[iLane] ) / ( S_o[iLane] - Speed_M[iLane] );
+    State[iLane] = Rho_S * Rho_o[iLane];
+    State[(nVar-1)*BATCH_SIZE+iLane] = Rho_S * ( Rho_o[iLane] * E_o[iLane] - ( P_o[iLane] * ProjVel_o[iLane] - P_Star[iLane] * Speed_M[iLane] ) / ( S_o[iLane] - ProjVel_o[iLane] ) );
+    E_Star[iLane] = State[(nVar-1)*BATCH_SIZE+iLane];
+    Omega_Lane[iLane] = 1/(S_o[iLane]-Speed_M[iLane]);
+    OmegaSM_Lane[iLane] = Omega_Lane[iLane] * Speed_M[iLane];
+  }
+  for (iDim = 0; iDim < nDim; iDim++) {
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+      Flux_Phys[(iDim+1)*BATCH_SIZE+iLane] = Rho_o[iLane] * Vel_o[iDim*BATCH_SIZE+iLane] * ProjVel_o[iLane] + P_o[iLane] * Unit_Normal[iDim*BATCH_SIZE+iLane];
+      Rho_S = ( S_o[iLane] - ProjVel_o[iLane] ) / ( S_o[iLane] - Speed_M[iLane] );
+      State[(iDim+1)*BATCH_SIZE+iLane] = Rho_S * ( Rho_o[iLane] * Vel_o[iDim*BATCH_SIZE+iLane] + ( P_Star[iLane] - P_o[iLane] ) / ( S_o[iLane] - ProjVel_o[iLane] ) * Unit_Normal[iDim*BATCH_SIZE+iLane] );
+    }
+  }
+  
+  /*--- Residual ---*/
+  
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    Residual[iLane] = Speed_M[iLane] * State[iLane];
+    Residual[(nVar-1)*BATCH_SIZE+iLane] = Speed_M[iLane] * ( State[(nVar-1)*BATCH_SIZE+iLane] + P_Star[iLane] );
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Residual[(iDim+1)*BATCH_SIZE+iLane] = Speed_M[iLane] * State[(iDim+1)*BATCH_SIZE+iLane] + P_Star[iLane] * Unit_Normal[iDim*BATCH_SIZE+iLane];
+  
+  for (iVar = 0; iVar < nVar; iVar++) {
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+      Residual[iVar*BATCH_SIZE+iLane] = Supersonic[iLane]? Flux_Phys[iVar*BATCH_SIZE+iLane] : Residual[iVar*BATCH_SIZE+iLane];
+      Residual[iVar*BATCH_SIZE+iLane] *= Area_Lane[iLane];
+    }
+  }
+  
+  if (!implicit) return;
+  
+  /*--- Jacobian of the physical flux of the upwind side ---*/
+  
+  GetInviscidProjJac_Batch(Vel_o, E_o, Unit_Normal, 1.0, Jac_Phys);
+  
+  /*--------- Jacobian of the star flux w.r.t. the upwind side ---------*/
+  
+  /*--- Computing pressure derivatives (PI) ---*/
+  
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    dPI[iLane] = 0.5 * Gamma_Minus_One * Sq_o[iLane];
+    dPI[(nVar-1)*BATCH_SIZE+iLane] = Gamma_Minus_One;
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      dPI[(iDim+1)*BATCH_SIZE+iLane] = - Gamma_Minus_One * Vel_o[iDim*BATCH_SIZE+iLane];
+  
+  /*--- Computing d(Sm), d(rhoStar) ---*/
+  
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    dSm[iLane] = Sign[iLane] * ( - ProjVel_o[iLane] * ProjVel_o[iLane] + Speed_M[iLane] * S_o[iLane] + dPI[iLane] ) / Rho_Star[iLane];
+    dSm[(nVar-1)*BATCH_SIZE+iLane] = Sign[iLane] * dPI[(nVar-1)*BATCH_SIZE+iLane] / Rho_Star[iLane];
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      dSm[(iDim+1)*BATCH_SIZE+iLane] = Sign[iLane] * ( Unit_Normal[iDim*BATCH_SIZE+iLane] * ( 2 * ProjVel_o[iLane] - S_o[iLane] - Speed_M[iLane] ) + dPI[(iDim+1)*BATCH_SIZE+iLane] ) / Rho_Star[iLane];
+  
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    drhoStar[iLane] = Omega_Lane[iLane] * ( S_o[iLane] + State[iLane] * dSm[iLane] );
+    drhoStar[(nVar-1)*BATCH_SIZE+iLane] = Omega_Lane[iLane] * State[iLane] * dSm[(nVar-1)*BATCH_SIZE+iLane];
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      drhoStar[(iDim+1)*BATCH_SIZE+iLane] = Omega_Lane[iLane] * ( - Unit_Normal[iDim*BATCH_SIZE+iLane] + State[iLane] * dSm[(iDim+1)*BATCH_SIZE+iLane] );
+  
+  /*--- Computing d(pStar), d(EStar) ---*/
+  
+  for (iVar = 0; iVar < nVar; iVar++) {
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+      dpStar[iVar*BATCH_SIZE+iLane] = Rho_o[iLane] * (S_x[iLane] - ProjVel_x[iLane]) * dSm[iVar*BATCH_SIZE+iLane];
+      dEStar[iVar*BATCH_SIZE+iLane] = Omega_Lane[iLane] * ( Speed_M[iLane] * dpStar[iVar*BATCH_SIZE+iLane] + ( E_Star[iLane] + P_Star[iLane] ) * dSm[iVar*BATCH_SIZE+iLane] );
+    }
+  }
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    dEStar[iLane] += Omega_Lane[iLane] * ProjVel_o[iLane] * ( H_o[iLane] - dPI[iLane] );
+    dEStar[(nVar-1)*BATCH_SIZE+iLane] += Omega_Lane[iLane] * ( S_o[iLane] - ProjVel_o[iLane] - ProjVel_o[iLane] * dPI[(nVar-1)*BATCH_SIZE+iLane] );
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      dEStar[(iDim+1)*BATCH_SIZE+iLane] += Omega_Lane[iLane] * ( - Unit_Normal[iDim*BATCH_SIZE+iLane] * H_o[iLane] - ProjVel_o[iLane] * dPI[(iDim+1)*BATCH_SIZE+iLane] );
+  
+  /*--- First, middle and last rows ---*/
+  
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Jac_Own[iVar*BATCH_SIZE+iLane] = Speed_M[iLane] * drhoStar[iVar*BATCH_SIZE+iLane] + State[iLane] * dSm[iVar*BATCH_SIZE+iLane];
+  
+  for (jDim = 0; jDim < nDim; jDim++) {
+    Jac = &Jac_Own[(jDim+1)*nVar*BATCH_SIZE];
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+        Jac[iVar*BATCH_SIZE+iLane] = ( OmegaSM_Lane[iLane] + 1 ) * ( Unit_Normal[jDim*BATCH_SIZE+iLane] * dpStar[iVar*BATCH_SIZE+iLane] + State[(jDim+1)*BATCH_SIZE+iLane] * dSm[iVar*BATCH_SIZE+iLane] );
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+      Jac[iLane] += OmegaSM_Lane[iLane] * Vel_o[jDim*BATCH_SIZE+iLane] * ProjVel_o[iLane];
+      Jac[(jDim+1)*BATCH_SIZE+iLane] += OmegaSM_Lane[iLane] * (S_o[iLane] - ProjVel_o[iLane]);
+    }
+    for (iDim_Lane = 0; iDim_Lane < nDim; iDim_Lane++)
+      for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+        Jac[(iDim_Lane+1)*BATCH_SIZE+iLane] -= OmegaSM_Lane[iLane] * Vel_o[jDim*BATCH_SIZE+iLane] * Unit_Normal[iDim_Lane*BATCH_SIZE+iLane];
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+        Jac[iVar*BATCH_SIZE+iLane] -= OmegaSM_Lane[iLane] * dPI[iVar*BATCH_SIZE+iLane] * Unit_Normal[jDim*BATCH_SIZE+iLane];
+  }
+  
+  Jac = &Jac_Own[(nVar-1)*nVar*BATCH_SIZE];
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Jac[iVar*BATCH_SIZE+iLane] = Speed_M[iLane] * ( dEStar[iVar*BATCH_SIZE+iLane] + dpStar[iVar*BATCH_SIZE+iLane] ) + ( E_Star[iLane] + P_Star[iLane] ) * dSm[iVar*BATCH_SIZE+iLane];
+  
+  /*--------- Jacobian of the star flux w.r.t. the other side ---------*/
+  
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    dSm[iLane] = Sign[iLane] * ( ProjVel_x[iLane] * ProjVel_x[iLane] - Speed_M[iLane] * S_x[iLane] - 0.5 * Gamma_Minus_One * Sq_x[iLane] ) / Rho_Star[iLane];
+    dSm[(nVar-1)*BATCH_SIZE+iLane] = - Sign[iLane] * Gamma_Minus_One / Rho_Star[iLane];
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      dSm[(iDim+1)*BATCH_SIZE+iLane] = - Sign[iLane] * ( Unit_Normal[iDim*BATCH_SIZE+iLane] * ( 2 * ProjVel_x[iLane] - S_x[iLane] - Speed_M[iLane] ) - Gamma_Minus_One * Vel_x[iDim*BATCH_SIZE+iLane] ) / Rho_Star[iLane];
+  
+  for (iVar = 0; iVar < nVar; iVar++) {
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+      dpStar[iVar*BATCH_SIZE+iLane] = Rho_x[iLane] * (S_o[iLane] - ProjVel_o[iLane]) * dSm[iVar*BATCH_SIZE+iLane];
+      dEStar[iVar*BATCH_SIZE+iLane] = Omega_Lane[iLane] * ( Speed_M[iLane] * dpStar[iVar*BATCH_SIZE+iLane] + ( E_Star[iLane] + P_Star[iLane] ) * dSm[iVar*BATCH_SIZE+iLane] );
+    }
+  }
+  
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Jac_Other[iVar*BATCH_SIZE+iLane] = State[iLane] * ( OmegaSM_Lane[iLane] + 1 ) * dSm[iVar*BATCH_SIZE+iLane];
+  
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Jac = &Jac_Other[(iDim+1)*nVar*BATCH_SIZE];
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+        Jac[iVar*BATCH_SIZE+iLane] = ( OmegaSM_Lane[iLane] + 1 ) * ( State[(iDim+1)*BATCH_SIZE+iLane] * dSm[iVar*BATCH_SIZE+iLane] + Unit_Normal[iDim*BATCH_SIZE+iLane] * dpStar[iVar*BATCH_SIZE+iLane] );
+  }
+  
+  Jac = &Jac_Other[(nVar-1)*nVar*BATCH_SIZE];
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Jac[iVar*BATCH_SIZE+iLane] = Speed_M[iLane] * (dEStar[iVar*BATCH_SIZE+iLane] + dpStar[iVar*BATCH_SIZE+iLane]) + (E_Star[iLane] + P_Star[iLane]) * dSm[iVar*BATCH_SIZE+iLane];
+  
+  /*--- Select the Jacobians of each lane, scale = k because val_residual ~ 0.5*(fc_i+fc_j)*Normal ---*/
+  
+  for (iVar = 0; iVar < nVar*nVar; iVar++) {
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+      Jac_Own[iVar*BATCH_SIZE+iLane] = Supersonic[iLane]? Jac_Phys[iVar*BATCH_SIZE+iLane] : Jac_Own[iVar*BATCH_SIZE+iLane];
+      Jac_Other[iVar*BATCH_SIZE+iLane] = Supersonic[iLane]? 0.0 : Jac_Other[iVar*BATCH_SIZE+iLane];
+      Jacobian_i[iVar*BATCH_SIZE+iLane] = (Left[iLane]? Jac_Own[iVar*BATCH_SIZE+iLane] : Jac_Other[iVar*BATCH_SIZE+iLane]) * Area_Kappa[iLane];
+      Jacobian_j[iVar*BATCH_SIZE+iLane] = (Left[iLane]? Jac_Other[iVar*BATCH_SIZE+iLane] : Jac_Own[iVar*BATCH_SIZE+iLane]) * Area_Kappa[iLane];
+    }
+  }
+  
+}
+
 CUpwGeneralHLLC_Flow::CUpwGeneralHLLC_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) : CNumerics(val_nDim, val_nVar, config) {
   
   implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
@@ -2986,6 +3401,154 @@ void CUpwRoe_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jaco
   
 }
 
+void CUpwRoe_Flow::ComputeResidual_Batch(CNumericsBatch *val_batch, CConfig *config) {
+  
+  unsigned short iLane;
+  su2double *V_i = val_batch->V_i, *V_j = val_batch->V_j, *Normal = val_batch->Normal,
+  *Residual = val_batch->Residual, *Jacobian_i = val_batch->Jacobian_i, *Jacobian_j = val_batch->Jacobian_j;
+  
+  su2double U_i[5*BATCH_SIZE], U_j[5*BATCH_SIZE], Vel_i[3*BATCH_SIZE], Vel_j[3*BATCH_SIZE], RoeVel[3*BATCH_SIZE],
+  Unit_Normal[3*BATCH_SIZE], Flux_i[5*BATCH_SIZE], Flux_j[5*BATCH_SIZE], Lambda_Abs[5*BATCH_SIZE],
+  P[5*5*BATCH_SIZE], invP[5*5*BATCH_SIZE], Area_Lane[BATCH_SIZE], Rho_i[BATCH_SIZE], Rho_j[BATCH_SIZE],
+  P_i[BATCH_SIZE], P_j[BATCH_SIZE], H_i[BATCH_SIZE], H_j[BATCH_SIZE], E_i[BATCH_SIZE], E_j[BATCH_SIZE],
+  RoeRho[BATCH_SIZE], RoeH[BATCH_SIZE], RoeC[BATCH_SIZE], SqVel[BATCH_SIZE], ProjVel[BATCH_SIZE],
+  Ratio[BATCH_SIZE], ModJac[BATCH_SIZE];
+  bool Valid[BATCH_SIZE];
+  
+  /*--- Same operations as ComputeResidual (fixed grids and standard dissipation),
+   each loop is over the lanes of the pack so that it can be vectorized ---*/
+  
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) Area_Lane[iLane] = 0.0;
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Area_Lane[iLane] += Normal[iDim*BATCH_SIZE+iLane]*Normal[iDim*BATCH_SIZE+iLane];
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) Area_Lane[iLane] = sqrt(Area_Lane[iLane]);
+  
+  for (iDim = 0; iDim < nDim; iDim++) {
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+      Unit_Normal[iDim*BATCH_SIZE+iLane] = Normal[iDim*BATCH_SIZE+iLane]/Area_Lane[iLane];
+      Vel_i[iDim*BATCH_SIZE+iLane] = V_i[(iDim+1)*BATCH_SIZE+iLane];
+      Vel_j[iDim*BATCH_SIZE+iLane] = V_j[(iDim+1)*BATCH_SIZE+iLane];
+    }
+  }
+  
+  /*--- Primitive and conservative variables at points i and j ---*/
+  
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    P_i[iLane] = V_i[(nDim+1)*BATCH_SIZE+iLane];   P_j[iLane] = V_j[(nDim+1)*BATCH_SIZE+iLane];
+    Rho_i[iLane] = V_i[(nDim+2)*BATCH_SIZE+iLane]; Rho_j[iLane] = V_j[(nDim+2)*BATCH_SIZE+iLane];
+    H_i[iLane] = V_i[(nDim+3)*BATCH_SIZE+iLane];   H_j[iLane] = V_j[(nDim+3)*BATCH_SIZE+iLane];
+    E_i[iLane] = H_i[iLane] - P_i[iLane]/Rho_i[iLane];
+    E_j[iLane] = H_j[iLane] - P_j[iLane]/Rho_j[iLane];
+    U_i[iLane] = Rho_i[iLane]; U_j[iLane] = Rho_j[iLane];
+    U_i[(nDim+1)*BATCH_SIZE+iLane] = Rho_i[iLane]*E_i[iLane];
+    U_j[(nDim+1)*BATCH_SIZE+iLane] = Rho_j[iLane]*E_j[iLane];
+  }
+  for (iDim = 0; iDim < nDim; iDim++) {
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+      U_i[(iDim+1)*BATCH_SIZE+iLane] = Rho_i[iLane]*Vel_i[iDim*BATCH_SIZE+iLane];
+      U_j[(iDim+1)*BATCH_SIZE+iLane] = Rho_j[iLane]*Vel_j[iDim*BATCH_SIZE+iLane];
+    }
+  }
+  
+  /*--- Roe-averaged variables at interface between i & j ---*/
+  
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    Ratio[iLane] = sqrt(fabs(Rho_j[iLane]/Rho_i[iLane]));
+    RoeRho[iLane] = Ratio[iLane]*Rho_i[iLane];
+    SqVel[iLane] = 0.0;
+  }
+  for (iDim = 0; iDim < nDim; iDim++) {
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+      RoeVel[iDim*BATCH_SIZE+iLane] = (Ratio[iLane]*Vel_j[iDim*BATCH_SIZE+iLane]+Vel_i[iDim*BATCH_SIZE+iLane])/(Ratio[iLane]+1);
+      SqVel[iLane] += RoeVel[iDim*BATCH_SIZE+iLane]*RoeVel[iDim*BATCH_SIZE+iLane];
+    }
+  }
+  
+  /*--- A lane with a negative RoeSoundSpeed2 (too large jump) is computed with a
+   dummy speed of sound and its residual and Jacobians are set to zero at the end ---*/
+  
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    RoeH[iLane] = (Ratio[iLane]*H_j[iLane]+H_i[iLane])/(Ratio[iLane]+1);
+    RoeC[iLane] = (Gamma-1)*(RoeH[iLane]-0.5*SqVel[iLane]);
+    Valid[iLane] = (RoeC[iLane] > 0.0);
+    RoeC[iLane] = Valid[iLane]? sqrt(RoeC[iLane]) : 1.0;
+  }
+  
+  /*--- Projected fluxes, P and inverse P, and Jacobians of the inviscid flux,
+   scaled by kappa because val_resconv ~ kappa*(fc_i+fc_j)*Normal ---*/
+  
+  GetInviscidProjFlux_Batch(Rho_i, Vel_i, P_i, H_i, Normal, Flux_i);
+  GetInviscidProjFlux_Batch(Rho_j, Vel_j, P_j, H_j, Normal, Flux_j);
+  
+  GetPMatrix_Batch(RoeRho, RoeVel, RoeC, Unit_Normal, P);
+  GetPMatrix_inv_Batch(RoeRho, RoeVel, RoeC, Unit_Normal, invP);
+  
+  if (implicit) {
+    GetInviscidProjJac_Batch(Vel_i, E_i, Normal, kappa, Jacobian_i);
+    GetInviscidProjJac_Batch(Vel_j, E_j, Normal, kappa, Jacobian_j);
+  }
+  
+  /*--- Flow eigenvalues with Mavriplis' entropy correction ---*/
+  
+  Delta = config->GetEntropyFix_Coeff();
+  
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) ProjVel[iLane] = 0.0;
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      ProjVel[iLane] += RoeVel[iDim*BATCH_SIZE+iLane]*Unit_Normal[iDim*BATCH_SIZE+iLane];
+  
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    MaxLambda = fabs(ProjVel[iLane]) + RoeC[iLane];
+    for (iDim = 0; iDim < nDim; iDim++)
+      Lambda_Abs[iDim*BATCH_SIZE+iLane] = max(fabs(ProjVel[iLane]), Delta*MaxLambda);
+    Lambda_Abs[(nVar-2)*BATCH_SIZE+iLane] = max(fabs(ProjVel[iLane] + RoeC[iLane]), Delta*MaxLambda);
+    Lambda_Abs[(nVar-1)*BATCH_SIZE+iLane] = max(fabs(ProjVel[iLane] - RoeC[iLane]), Delta*MaxLambda);
+  }
+  
+  /*--- Roe's flux approximation, |Proj_ModJac_Tensor| = P x |Lambda| x inverse P ---*/
+  
+  for (iVar = 0; iVar < nVar; iVar++) {
+    
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Residual[iVar*BATCH_SIZE+iLane] = kappa*(Flux_i[iVar*BATCH_SIZE+iLane]+Flux_j[iVar*BATCH_SIZE+iLane]);
+    
+    for (jVar = 0; jVar < nVar; jVar++) {
+      
+      for (iLane = 0; iLane < BATCH_SIZE; iLane++) ModJac[iLane] = 0.0;
+      for (kVar = 0; kVar < nVar; kVar++)
+        for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+          ModJac[iLane] += P[(iVar*nVar+kVar)*BATCH_SIZE+iLane]*Lambda_Abs[kVar*BATCH_SIZE+iLane]*invP[(kVar*nVar+jVar)*BATCH_SIZE+iLane];
+      
+      for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+        Residual[iVar*BATCH_SIZE+iLane] -= (1.0-kappa)*ModJac[iLane]*(U_j[jVar*BATCH_SIZE+iLane]-U_i[jVar*BATCH_SIZE+iLane])*Area_Lane[iLane]*Dissipation_ij;
+      
+      if (implicit) {
+        for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+          Jacobian_i[(iVar*nVar+jVar)*BATCH_SIZE+iLane] += (1.0-kappa)*ModJac[iLane]*Area_Lane[iLane];
+          Jacobian_j[(iVar*nVar+jVar)*BATCH_SIZE+iLane] -= (1.0-kappa)*ModJac[iLane]*Area_Lane[iLane];
+        }
+      }
+    }
+  }
+  
+  /*--- Lanes without a valid Roe state do not contribute ---*/
+  
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Residual[iVar*BATCH_SIZE+iLane] = Valid[iLane]? Residual[iVar*BATCH_SIZE+iLane] : 0.0;
+  
+  if (implicit) {
+    for (iVar = 0; iVar < nVar*nVar; iVar++) {
+      for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+        Jacobian_i[iVar*BATCH_SIZE+iLane] = Valid[iLane]? Jacobian_i[iVar*BATCH_SIZE+iLane] : 0.0;
+        Jacobian_j[iVar*BATCH_SIZE+iLane] = Valid[iLane]? Jacobian_j[iVar*BATCH_SIZE+iLane] : 0.0;
+      }
+    }
+  }
+  
+}
+
 CUpwGeneralRoe_Flow::CUpwGeneralRoe_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) : CNumerics(val_nDim, val_nVar, config) {
 
   implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
@@ -4449,6 +5012,12 @@ void CAvgGrad_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jac
   
 }
 
+void CAvgGrad_Flow::ComputeResidual_Batch(CNumericsBatch *val_batch, CConfig *config) {
+  
+  GetViscousResidual_Batch(val_batch, false, implicit);
+  
+}
+
 CGeneralAvgGrad_Flow::CGeneralAvgGrad_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) : CNumerics(val_nDim, val_nVar, config) {
   
   implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
@@ -4691,6 +5260,12 @@ void CAvgGradCorrected_Flow::ComputeResidual(su2double *val_residual, su2double
   
 }
 
+void CAvgGradCorrected_Flow::ComputeResidual_Batch(CNumericsBatch *val_batch, CConfig *config) {
+  
+  GetViscousResidual_Batch(val_batch, true, implicit);
+  
+}
+
 //CGeneralAvgGradCorrected_Flow::CGeneralAvgGradCorrected_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) : CNumerics(val_nDim, val_nVar, config) {
 //
 //  implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
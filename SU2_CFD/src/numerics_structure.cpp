@@ -62,6 +62,9 @@ CNumerics::CNumerics(void) {
   l = NULL;
   m = NULL;
 
+  nThread_Numerics = 1;
+  Thread_Numerics  = NULL;
+
 }
 
 CNumerics::CNumerics(unsigned short val_nDim, unsigned short val_nVar,
@@ -91,6 +94,9 @@ CNumerics::CNumerics(unsigned short val_nDim, unsigned short val_nVar,
 
   l = NULL;
   m = NULL;
+
+  nThread_Numerics = 1;
+  Thread_Numerics  = NULL;
  
   nDim = val_nDim;
   nVar = val_nVar;
@@ -185,6 +191,183 @@ CNumerics::~CNumerics(void) {
   if (l != NULL) delete [] l;
   if (m != NULL) delete [] m;
 
+  if (Thread_Numerics != NULL) {
+    for (unsigned short iThread = 1; iThread < nThread_Numerics; iThread++)
+      if (Thread_Numerics[iThread] != NULL) delete Thread_Numerics[iThread];
+    delete [] Thread_Numerics;
+  }
+
+}
+
+void CNumerics::SetThread_Numerics(unsigned short val_nthread, unsigned short val_thread, CNumerics *val_numerics) {
+
+  unsigned short iThread;
+
+  if (Thread_Numerics == NULL) {
+    nThread_Numerics = val_nthread;
+    Thread_Numerics = new CNumerics* [nThread_Numerics];
+    Thread_Numerics[0] = this;
+    for (iThread = 1; iThread < nThread_Numerics; iThread++)
+      Thread_Numerics[iThread] = NULL;
+  }
+
+  Thread_Numerics[val_thread] = val_numerics;
+
+}
+
+CNumericsBatch::CNumericsBatch(unsigned short val_nDim, unsigned short val_nVar, bool val_viscous) {
+  
+  nDim = val_nDim;
+  nVar = val_nVar;
+  viscous = val_viscous;
+  nPrimVar = (viscous? nDim+7 : nDim+5);
+  nEdge = 0;
+  
+  Normal     = new su2double [nDim*BATCH_SIZE];
+  V_i        = new su2double [nPrimVar*BATCH_SIZE];
+  V_j        = new su2double [nPrimVar*BATCH_SIZE];
+  Und_Lapl_i = new su2double [nVar*BATCH_SIZE];
+  Und_Lapl_j = new su2double [nVar*BATCH_SIZE];
+  Residual   = new su2double [nVar*BATCH_SIZE];
+  Jacobian_i = new su2double [nVar*nVar*BATCH_SIZE];
+  Jacobian_j = new su2double [nVar*nVar*BATCH_SIZE];
+  
+  /*--- The centered data is not used by all the schemes, it must still be
+   a valid number since all the lanes are computed ---*/
+  
+  for (unsigned short iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    Lambda_i[iLane] = 1.0; Lambda_j[iLane] = 1.0;
+    Sensor_i[iLane] = 0.0; Sensor_j[iLane] = 0.0;
+    Neighbor_i[iLane] = 1.0; Neighbor_j[iLane] = 1.0;
+  }
+  for (unsigned short iVar = 0; iVar < nVar*BATCH_SIZE; iVar++) {
+    Und_Lapl_i[iVar] = 0.0; Und_Lapl_j[iVar] = 0.0;
+  }
+  
+  Coord_i = NULL; Coord_j = NULL;
+  PrimVar_Grad_i = NULL; PrimVar_Grad_j = NULL;
+  
+  if (viscous) {
+    Coord_i        = new su2double [nDim*BATCH_SIZE];
+    Coord_j        = new su2double [nDim*BATCH_SIZE];
+    PrimVar_Grad_i = new su2double [(nDim+1)*nDim*BATCH_SIZE];
+    PrimVar_Grad_j = new su2double [(nDim+1)*nDim*BATCH_SIZE];
+  }
+  
+  /*--- Without a turbulence model the kinetic energy is zero, as in CAvgGrad_Flow ---*/
+  
+  for (unsigned short iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    TurbKE_i[iLane] = 0.0; TurbKE_j[iLane] = 0.0;
+  }
+  
+}
+
+CNumericsBatch::~CNumericsBatch(void) {
+  
+  delete [] Normal;
+  delete [] V_i;
+  delete [] V_j;
+  delete [] Und_Lapl_i;
+  delete [] Und_Lapl_j;
+  delete [] Residual;
+  delete [] Jacobian_i;
+  delete [] Jacobian_j;
+  
+  if (Coord_i != NULL) delete [] Coord_i;
+  if (Coord_j != NULL) delete [] Coord_j;
+  if (PrimVar_Grad_i != NULL) delete [] PrimVar_Grad_i;
+  if (PrimVar_Grad_j != NULL) delete [] PrimVar_Grad_j;
+  
+}
+
+unsigned short CNumericsBatch::AddEdge(unsigned long val_edge, unsigned long val_point_i, unsigned long val_point_j,
+                                       su2double *val_normal, su2double *val_v_i, su2double *val_v_j) {
+  
+  unsigned short iDim, iVar, iLane = nEdge;
+  
+  Edge[iLane] = val_edge;
+  Point_i[iLane] = val_point_i;
+  Point_j[iLane] = val_point_j;
+  
+  for (iDim = 0; iDim < nDim; iDim++)
+    Normal[iDim*BATCH_SIZE+iLane] = val_normal[iDim];
+  
+  for (iVar = 0; iVar < nPrimVar; iVar++) {
+    V_i[iVar*BATCH_SIZE+iLane] = val_v_i[iVar];
+    V_j[iVar*BATCH_SIZE+iLane] = val_v_j[iVar];
+  }
+  
+  nEdge++;
+  
+  return iLane;
+  
+}
+
+void CNumericsBatch::SetUndivided_Laplacian(unsigned short val_lane, su2double *val_und_lapl_i, su2double *val_und_lapl_j) {
+  
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+    Und_Lapl_i[iVar*BATCH_SIZE+val_lane] = val_und_lapl_i[iVar];
+    Und_Lapl_j[iVar*BATCH_SIZE+val_lane] = val_und_lapl_j[iVar];
+  }
+  
+}
+
+void CNumericsBatch::SetCoord(unsigned short val_lane, su2double *val_coord_i, su2double *val_coord_j) {
+  
+  for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+    Coord_i[iDim*BATCH_SIZE+val_lane] = val_coord_i[iDim];
+    Coord_j[iDim*BATCH_SIZE+val_lane] = val_coord_j[iDim];
+  }
+  
+}
+
+void CNumericsBatch::SetPrimVarGradient(unsigned short val_lane, su2double *val_grad_i, su2double *val_grad_j) {
+  
+  for (unsigned short iVar = 0; iVar < (nDim+1)*nDim; iVar++) {
+    PrimVar_Grad_i[iVar*BATCH_SIZE+val_lane] = val_grad_i[iVar];
+    PrimVar_Grad_j[iVar*BATCH_SIZE+val_lane] = val_grad_j[iVar];
+  }
+  
+}
+
+void CNumericsBatch::Fill(void) {
+  
+  unsigned short iDim, iVar, iLane;
+  
+  for (iLane = nEdge; iLane < BATCH_SIZE; iLane++) {
+    for (iDim = 0; iDim < nDim; iDim++)
+      Normal[iDim*BATCH_SIZE+iLane] = Normal[iDim*BATCH_SIZE];
+    for (iVar = 0; iVar < nPrimVar; iVar++) {
+      V_i[iVar*BATCH_SIZE+iLane] = V_i[iVar*BATCH_SIZE];
+      V_j[iVar*BATCH_SIZE+iLane] = V_j[iVar*BATCH_SIZE];
+    }
+    for (iVar = 0; iVar < nVar; iVar++) {
+      Und_Lapl_i[iVar*BATCH_SIZE+iLane] = Und_Lapl_i[iVar*BATCH_SIZE];
+      Und_Lapl_j[iVar*BATCH_SIZE+iLane] = Und_Lapl_j[iVar*BATCH_SIZE];
+    }
+    Lambda_i[iLane] = Lambda_i[0]; Lambda_j[iLane] = Lambda_j[0];
+    Sensor_i[iLane] = Sensor_i[0]; Sensor_j[iLane] = Sensor_j[0];
+    Neighbor_i[iLane] = Neighbor_i[0]; Neighbor_j[iLane] = Neighbor_j[0];
+    TurbKE_i[iLane] = TurbKE_i[0]; TurbKE_j[iLane] = TurbKE_j[0];
+    if (viscous) {
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Coord_i[iDim*BATCH_SIZE+iLane] = Coord_i[iDim*BATCH_SIZE];
+        Coord_j[iDim*BATCH_SIZE+iLane] = Coord_j[iDim*BATCH_SIZE];
+      }
+      for (iVar = 0; iVar < (nDim+1)*nDim; iVar++) {
+        PrimVar_Grad_i[iVar*BATCH_SIZE+iLane] = PrimVar_Grad_i[iVar*BATCH_SIZE];
+        PrimVar_Grad_j[iVar*BATCH_SIZE+iLane] = PrimVar_Grad_j[iVar*BATCH_SIZE];
+      }
+    }
+  }
+  
+}
+
+void CNumericsBatch::GetResidual(unsigned short val_lane, su2double *val_residual) {
+  
+  for (unsigned short iVar = 0; iVar < nVar; iVar++)
+    val_residual[iVar] = Residual[iVar*BATCH_SIZE+val_lane];
+  
 }
 
 void CNumerics::GetInviscidFlux(su2double val_density, su2double *val_velocity,
@@ -342,6 +525,116 @@ void CNumerics::GetInviscidProjJac(su2double *val_velocity, su2double *val_energ
 }
 
 
+void CNumerics::GetInviscidProjFlux_Batch(su2double *val_density, su2double *val_velocity,
+                                          su2double *val_pressure, su2double *val_enthalpy,
+                                          su2double *val_normal, su2double *val_Proj_Flux) {
+  
+  unsigned short iDim, jDim, iLane;
+  su2double rhov, *Velocity, *Flux, *Normal, Term;
+  
+  /*--- Same operations as GetInviscidProjFlux (the contributions of the
+   normal components are added in order), with the lanes in the innermost loop ---*/
+  
+  for (iDim = 0; iDim < nDim; iDim++) {
+    
+    Velocity = &val_velocity[iDim*BATCH_SIZE];
+    Normal = &val_normal[iDim*BATCH_SIZE];
+    
+    Flux = &val_Proj_Flux[0];
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+      Term = val_density[iLane]*Velocity[iLane]*Normal[iLane];
+      Flux[iLane] = (iDim == 0)? Term : Flux[iLane]+Term;
+    }
+    
+    for (jDim = 0; jDim < nDim; jDim++) {
+      Flux = &val_Proj_Flux[(jDim+1)*BATCH_SIZE];
+      for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+        rhov = val_density[iLane]*Velocity[iLane];
+        if (iDim == jDim) Term = (rhov*val_velocity[jDim*BATCH_SIZE+iLane]+val_pressure[iLane])*Normal[iLane];
+        else Term = rhov*val_velocity[jDim*BATCH_SIZE+iLane]*Normal[iLane];
+        Flux[iLane] = (iDim == 0)? Term : Flux[iLane]+Term;
+      }
+    }
+    
+    Flux = &val_Proj_Flux[(nDim+1)*BATCH_SIZE];
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+      Term = val_density[iLane]*Velocity[iLane]*val_enthalpy[iLane]*Normal[iLane];
+      Flux[iLane] = (iDim == 0)? Term : Flux[iLane]+Term;
+    }
+    
+  }
+  
+}
+
+void CNumerics::GetInviscidProjJac_Batch(su2double *val_velocity, su2double *val_energy,
+                                         su2double *val_normal, su2double val_scale,
+                                         su2double *val_Proj_Jac_Tensor) {
+  
+  unsigned short iDim, jDim, iLane, nVar_Flow = nDim+2;
+  su2double sqvel[BATCH_SIZE], proj_vel[BATCH_SIZE], phi[BATCH_SIZE], a1[BATCH_SIZE], a2 = Gamma-1.0;
+  su2double *Jac;
+  
+#define JAC(I,J) (&val_Proj_Jac_Tensor[((I)*nVar_Flow+(J))*BATCH_SIZE])
+  
+  /*--- Same operations as GetInviscidProjJac, with the lanes in the innermost loop ---*/
+  
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    sqvel[iLane] = 0.0; proj_vel[iLane] = 0.0;
+  }
+  for (iDim = 0; iDim < nDim; iDim++) {
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+      sqvel[iLane]    += val_velocity[iDim*BATCH_SIZE+iLane]*val_velocity[iDim*BATCH_SIZE+iLane];
+      proj_vel[iLane] += val_velocity[iDim*BATCH_SIZE+iLane]*val_normal[iDim*BATCH_SIZE+iLane];
+    }
+  }
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    phi[iLane] = 0.5*Gamma_Minus_One*sqvel[iLane];
+    a1[iLane] = Gamma*val_energy[iLane]-phi[iLane];
+  }
+  
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    JAC(0,0)[iLane] = 0.0;
+    JAC(0,nDim+1)[iLane] = 0.0;
+  }
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Jac = JAC(0,iDim+1);
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Jac[iLane] = val_scale*val_normal[iDim*BATCH_SIZE+iLane];
+  }
+  
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Jac = JAC(iDim+1,0);
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Jac[iLane] = val_scale*(val_normal[iDim*BATCH_SIZE+iLane]*phi[iLane] - val_velocity[iDim*BATCH_SIZE+iLane]*proj_vel[iLane]);
+    for (jDim = 0; jDim < nDim; jDim++) {
+      Jac = JAC(iDim+1,jDim+1);
+      for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+        Jac[iLane] = val_scale*(val_normal[jDim*BATCH_SIZE+iLane]*val_velocity[iDim*BATCH_SIZE+iLane]-a2*val_normal[iDim*BATCH_SIZE+iLane]*val_velocity[jDim*BATCH_SIZE+iLane]);
+    }
+    Jac = JAC(iDim+1,iDim+1);
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Jac[iLane] += val_scale*proj_vel[iLane];
+    Jac = JAC(iDim+1,nDim+1);
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Jac[iLane] = val_scale*a2*val_normal[iDim*BATCH_SIZE+iLane];
+  }
+  
+  Jac = JAC(nDim+1,0);
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+    Jac[iLane] = val_scale*proj_vel[iLane]*(phi[iLane]-a1[iLane]);
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Jac = JAC(nDim+1,iDim+1);
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Jac[iLane] = val_scale*(val_normal[iDim*BATCH_SIZE+iLane]*a1[iLane]-a2*val_velocity[iDim*BATCH_SIZE+iLane]*proj_vel[iLane]);
+  }
+  Jac = JAC(nDim+1,nDim+1);
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+    Jac[iLane] = val_scale*Gamma*proj_vel[iLane];
+  
+#undef JAC
+  
+}
+
 void CNumerics::GetInviscidProjJac(su2double *val_velocity, su2double *val_enthalpy,
     su2double *val_chi, su2double *val_kappa,
     su2double *val_normal, su2double val_scale,
@@ -517,6 +810,83 @@ void CNumerics::GetPMatrix(su2double *val_density, su2double *val_velocity,
   
 }
 
+void CNumerics::GetPMatrix_Batch(su2double *val_density, su2double *val_velocity,
+                                 su2double *val_soundspeed, su2double *val_normal, su2double *val_p_tensor) {
+  
+  unsigned short iLane;
+  su2double sqvel, rhooc, rhoxc;
+  
+  /*--- Same expressions as GetPMatrix, for each lane of the pack ---*/
+  
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    
+    rhooc = val_density[iLane] / val_soundspeed[iLane];
+    rhoxc = val_density[iLane] * val_soundspeed[iLane];
+    
+    if (nDim == 2) {
+      
+      sqvel = val_velocity[iLane]*val_velocity[iLane]+val_velocity[BATCH_SIZE+iLane]*val_velocity[BATCH_SIZE+iLane];
+      
+      val_p_tensor[iLane] = 1.0;
+      val_p_tensor[BATCH_SIZE+iLane]=0.0;
+      val_p_tensor[2*BATCH_SIZE+iLane]=0.5*rhooc;
+      val_p_tensor[3*BATCH_SIZE+iLane]=0.5*rhooc;
+      
+      val_p_tensor[4*BATCH_SIZE+iLane]=val_velocity[iLane];
+      val_p_tensor[5*BATCH_SIZE+iLane]=val_density[iLane]*val_normal[BATCH_SIZE+iLane];
+      val_p_tensor[6*BATCH_SIZE+iLane]=0.5*(val_velocity[iLane]*rhooc+val_normal[iLane]*val_density[iLane]);
+      val_p_tensor[7*BATCH_SIZE+iLane]=0.5*(val_velocity[iLane]*rhooc-val_normal[iLane]*val_density[iLane]);
+      
+      val_p_tensor[8*BATCH_SIZE+iLane]=val_velocity[BATCH_SIZE+iLane];
+      val_p_tensor[9*BATCH_SIZE+iLane]=-val_density[iLane]*val_normal[iLane];
+      val_p_tensor[10*BATCH_SIZE+iLane]=0.5*(val_velocity[BATCH_SIZE+iLane]*rhooc+val_normal[BATCH_SIZE+iLane]*val_density[iLane]);
+      val_p_tensor[11*BATCH_SIZE+iLane]=0.5*(val_velocity[BATCH_SIZE+iLane]*rhooc-val_normal[BATCH_SIZE+iLane]*val_density[iLane]);
+      
+      val_p_tensor[12*BATCH_SIZE+iLane]=0.5*sqvel;
+      val_p_tensor[13*BATCH_SIZE+iLane]=val_density[iLane]*val_velocity[iLane]*val_normal[BATCH_SIZE+iLane]-val_density[iLane]*val_velocity[BATCH_SIZE+iLane]*val_normal[iLane];
+      val_p_tensor[14*BATCH_SIZE+iLane]=0.5*(0.5*sqvel*rhooc+val_density[iLane]*val_velocity[iLane]*val_normal[iLane]+val_density[iLane]*val_velocity[BATCH_SIZE+iLane]*val_normal[BATCH_SIZE+iLane]+rhoxc/Gamma_Minus_One);
+      val_p_tensor[15*BATCH_SIZE+iLane]=0.5*(0.5*sqvel*rhooc-val_density[iLane]*val_velocity[iLane]*val_normal[iLane]-val_density[iLane]*val_velocity[BATCH_SIZE+iLane]*val_normal[BATCH_SIZE+iLane]+rhoxc/Gamma_Minus_One);
+      
+    }
+    else {
+      
+      sqvel = val_velocity[iLane]*val_velocity[iLane]+val_velocity[BATCH_SIZE+iLane]*val_velocity[BATCH_SIZE+iLane]+val_velocity[2*BATCH_SIZE+iLane]*val_velocity[2*BATCH_SIZE+iLane];
+      
+      val_p_tensor[iLane]=val_normal[iLane];
+      val_p_tensor[BATCH_SIZE+iLane]=val_normal[BATCH_SIZE+iLane];
+      val_p_tensor[2*BATCH_SIZE+iLane]=val_normal[2*BATCH_SIZE+iLane];
+      val_p_tensor[3*BATCH_SIZE+iLane]=0.5*rhooc;
+      val_p_tensor[4*BATCH_SIZE+iLane]=0.5*rhooc;
+      
+      val_p_tensor[5*BATCH_SIZE+iLane]=val_velocity[iLane]*val_normal[iLane];
+      val_p_tensor[6*BATCH_SIZE+iLane]=val_velocity[iLane]*val_normal[BATCH_SIZE+iLane]-val_density[iLane]*val_normal[2*BATCH_SIZE+iLane];
+      val_p_tensor[7*BATCH_SIZE+iLane]=val_velocity[iLane]*val_normal[2*BATCH_SIZE+iLane]+val_density[iLane]*val_normal[BATCH_SIZE+iLane];
+      val_p_tensor[8*BATCH_SIZE+iLane]=0.5*(val_velocity[iLane]*rhooc+val_density[iLane]*val_normal[iLane]);
+      val_p_tensor[9*BATCH_SIZE+iLane]=0.5*(val_velocity[iLane]*rhooc-val_density[iLane]*val_normal[iLane]);
+      
+      val_p_tensor[10*BATCH_SIZE+iLane]=val_velocity[BATCH_SIZE+iLane]*val_normal[iLane]+val_density[iLane]*val_normal[2*BATCH_SIZE+iLane];
+      val_p_tensor[11*BATCH_SIZE+iLane]=val_velocity[BATCH_SIZE+iLane]*val_normal[BATCH_SIZE+iLane];
+      val_p_tensor[12*BATCH_SIZE+iLane]=val_velocity[BATCH_SIZE+iLane]*val_normal[2*BATCH_SIZE+iLane]-val_density[iLane]*val_normal[iLane];
+      val_p_tensor[13*BATCH_SIZE+iLane]=0.5*(val_velocity[BATCH_SIZE+iLane]*rhooc+val_density[iLane]*val_normal[BATCH_SIZE+iLane]);
+      val_p_tensor[14*BATCH_SIZE+iLane]=0.5*(val_velocity[BATCH_SIZE+iLane]*rhooc-val_density[iLane]*val_normal[BATCH_SIZE+iLane]);
+      
+      val_p_tensor[15*BATCH_SIZE+iLane]=val_velocity[2*BATCH_SIZE+iLane]*val_normal[iLane]-val_density[iLane]*val_normal[BATCH_SIZE+iLane];
+      val_p_tensor[16*BATCH_SIZE+iLane]=val_velocity[2*BATCH_SIZE+iLane]*val_normal[BATCH_SIZE+iLane]+val_density[iLane]*val_normal[iLane];
+      val_p_tensor[17*BATCH_SIZE+iLane]=val_velocity[2*BATCH_SIZE+iLane]*val_normal[2*BATCH_SIZE+iLane];
+      val_p_tensor[18*BATCH_SIZE+iLane]=0.5*(val_velocity[2*BATCH_SIZE+iLane]*rhooc+val_density[iLane]*val_normal[2*BATCH_SIZE+iLane]);
+      val_p_tensor[19*BATCH_SIZE+iLane]=0.5*(val_velocity[2*BATCH_SIZE+iLane]*rhooc-val_density[iLane]*val_normal[2*BATCH_SIZE+iLane]);
+      
+      val_p_tensor[20*BATCH_SIZE+iLane]=0.5*sqvel*val_normal[iLane]+val_density[iLane]*val_velocity[BATCH_SIZE+iLane]*val_normal[2*BATCH_SIZE+iLane]-val_density[iLane]*val_velocity[2*BATCH_SIZE+iLane]*val_normal[BATCH_SIZE+iLane];
+      val_p_tensor[21*BATCH_SIZE+iLane]=0.5*sqvel*val_normal[BATCH_SIZE+iLane]-val_density[iLane]*val_velocity[iLane]*val_normal[2*BATCH_SIZE+iLane]+val_density[iLane]*val_velocity[2*BATCH_SIZE+iLane]*val_normal[iLane];
+      val_p_tensor[22*BATCH_SIZE+iLane]=0.5*sqvel*val_normal[2*BATCH_SIZE+iLane]+val_density[iLane]*val_velocity[iLane]*val_normal[BATCH_SIZE+iLane]-val_density[iLane]*val_velocity[BATCH_SIZE+iLane]*val_normal[iLane];
+      val_p_tensor[23*BATCH_SIZE+iLane]=0.5*(0.5*sqvel*rhooc+val_density[iLane]*(val_velocity[iLane]*val_normal[iLane]+val_velocity[BATCH_SIZE+iLane]*val_normal[BATCH_SIZE+iLane]+val_velocity[2*BATCH_SIZE+iLane]*val_normal[2*BATCH_SIZE+iLane])+rhoxc/Gamma_Minus_One);
+      val_p_tensor[24*BATCH_SIZE+iLane]=0.5*(0.5*sqvel*rhooc-val_density[iLane]*(val_velocity[iLane]*val_normal[iLane]+val_velocity[BATCH_SIZE+iLane]*val_normal[BATCH_SIZE+iLane]+val_velocity[2*BATCH_SIZE+iLane]*val_normal[2*BATCH_SIZE+iLane])+rhoxc/Gamma_Minus_One);
+      
+    }
+  }
+  
+}
+
 void CNumerics::GetPMatrix(su2double *val_density, su2double *val_velocity,
     su2double *val_soundspeed, su2double *val_enthalpy, su2double *val_chi, su2double *val_kappa, su2double *val_normal, su2double **val_p_tensor) {
 
@@ -663,6 +1033,88 @@ void CNumerics::GetPMatrix_inv(su2double *val_density, su2double *val_velocity,
   }
 }
 
+void CNumerics::GetPMatrix_inv_Batch(su2double *val_density, su2double *val_velocity,
+                                     su2double *val_soundspeed, su2double *val_normal, su2double *val_invp_tensor) {
+  
+  unsigned short iLane;
+  su2double rhoxc, c2, gm1, k0orho, k1orho, gm1_o_c2, gm1_o_rhoxc, sqvel;
+  
+  /*--- Same expressions as GetPMatrix_inv, for each lane of the pack ---*/
+  
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    
+    rhoxc = val_density[iLane] * val_soundspeed[iLane];
+    c2 = val_soundspeed[iLane] * val_soundspeed[iLane];
+    gm1 = Gamma_Minus_One;
+    k0orho = val_normal[iLane] / val_density[iLane];
+    k1orho = val_normal[BATCH_SIZE+iLane] / val_density[iLane];
+    gm1_o_c2 = gm1/c2;
+    gm1_o_rhoxc = gm1/rhoxc;
+
+    if (nDim == 3) {
+      
+      sqvel = val_velocity[iLane]*val_velocity[iLane]+val_velocity[BATCH_SIZE+iLane]*val_velocity[BATCH_SIZE+iLane]+val_velocity[2*BATCH_SIZE+iLane]*val_velocity[2*BATCH_SIZE+iLane];
+
+      val_invp_tensor[iLane]=val_normal[iLane]-val_normal[2*BATCH_SIZE+iLane]*val_velocity[BATCH_SIZE+iLane] / val_density[iLane]+val_normal[BATCH_SIZE+iLane]*val_velocity[2*BATCH_SIZE+iLane] / val_density[iLane]-val_normal[iLane]*0.5*gm1*sqvel/c2;
+      val_invp_tensor[BATCH_SIZE+iLane]=val_normal[iLane]*gm1*val_velocity[iLane]/c2;
+      val_invp_tensor[2*BATCH_SIZE+iLane]=val_normal[2*BATCH_SIZE+iLane] / val_density[iLane]+val_normal[iLane]*gm1*val_velocity[BATCH_SIZE+iLane]/c2;
+      val_invp_tensor[3*BATCH_SIZE+iLane]=-val_normal[BATCH_SIZE+iLane] / val_density[iLane]+val_normal[iLane]*gm1*val_velocity[2*BATCH_SIZE+iLane]/c2;
+      val_invp_tensor[4*BATCH_SIZE+iLane]=-val_normal[iLane]*gm1/c2;
+
+      val_invp_tensor[5*BATCH_SIZE+iLane]=val_normal[BATCH_SIZE+iLane]+val_normal[2*BATCH_SIZE+iLane]*val_velocity[iLane] / val_density[iLane]-val_normal[iLane]*val_velocity[2*BATCH_SIZE+iLane] / val_density[iLane]-val_normal[BATCH_SIZE+iLane]*0.5*gm1*sqvel/c2;
+      val_invp_tensor[6*BATCH_SIZE+iLane]=-val_normal[2*BATCH_SIZE+iLane] / val_density[iLane]+val_normal[BATCH_SIZE+iLane]*gm1*val_velocity[iLane]/c2;
+      val_invp_tensor[7*BATCH_SIZE+iLane]=val_normal[BATCH_SIZE+iLane]*gm1*val_velocity[BATCH_SIZE+iLane]/c2;
+      val_invp_tensor[8*BATCH_SIZE+iLane]=val_normal[iLane] / val_density[iLane]+val_normal[BATCH_SIZE+iLane]*gm1*val_velocity[2*BATCH_SIZE+iLane]/c2;
+      val_invp_tensor[9*BATCH_SIZE+iLane]=-val_normal[BATCH_SIZE+iLane]*gm1/c2;
+
+      val_invp_tensor[10*BATCH_SIZE+iLane]=val_normal[2*BATCH_SIZE+iLane]-val_normal[BATCH_SIZE+iLane]*val_velocity[iLane] / val_density[iLane]+val_normal[iLane]*val_velocity[BATCH_SIZE+iLane] / val_density[iLane]-val_normal[2*BATCH_SIZE+iLane]*0.5*gm1*sqvel/c2;
+      val_invp_tensor[11*BATCH_SIZE+iLane]=val_normal[BATCH_SIZE+iLane] / val_density[iLane]+val_normal[2*BATCH_SIZE+iLane]*gm1*val_velocity[iLane]/c2;
+      val_invp_tensor[12*BATCH_SIZE+iLane]=-val_normal[iLane] / val_density[iLane]+val_normal[2*BATCH_SIZE+iLane]*gm1*val_velocity[BATCH_SIZE+iLane]/c2;
+      val_invp_tensor[13*BATCH_SIZE+iLane]=val_normal[2*BATCH_SIZE+iLane]*gm1*val_velocity[2*BATCH_SIZE+iLane]/c2;
+      val_invp_tensor[14*BATCH_SIZE+iLane]=-val_normal[2*BATCH_SIZE+iLane]*gm1/c2;
+
+      val_invp_tensor[15*BATCH_SIZE+iLane]=-(val_normal[iLane]*val_velocity[iLane]+val_normal[BATCH_SIZE+iLane]*val_velocity[BATCH_SIZE+iLane]+val_normal[2*BATCH_SIZE+iLane]*val_velocity[2*BATCH_SIZE+iLane]) / val_density[iLane]+0.5*gm1*sqvel/rhoxc;
+      val_invp_tensor[16*BATCH_SIZE+iLane]=val_normal[iLane] / val_density[iLane]-gm1*val_velocity[iLane]/rhoxc;
+      val_invp_tensor[17*BATCH_SIZE+iLane]=val_normal[BATCH_SIZE+iLane] / val_density[iLane]-gm1*val_velocity[BATCH_SIZE+iLane]/rhoxc;
+      val_invp_tensor[18*BATCH_SIZE+iLane]=val_normal[2*BATCH_SIZE+iLane] / val_density[iLane]-gm1*val_velocity[2*BATCH_SIZE+iLane]/rhoxc;
+      val_invp_tensor[19*BATCH_SIZE+iLane]=Gamma_Minus_One/rhoxc;
+
+      val_invp_tensor[20*BATCH_SIZE+iLane]=(val_normal[iLane]*val_velocity[iLane]+val_normal[BATCH_SIZE+iLane]*val_velocity[BATCH_SIZE+iLane]+val_normal[2*BATCH_SIZE+iLane]*val_velocity[2*BATCH_SIZE+iLane]) / val_density[iLane]+0.5*gm1*sqvel/rhoxc;
+      val_invp_tensor[21*BATCH_SIZE+iLane]=-val_normal[iLane] / val_density[iLane]-gm1*val_velocity[iLane]/rhoxc;
+      val_invp_tensor[22*BATCH_SIZE+iLane]=-val_normal[BATCH_SIZE+iLane] / val_density[iLane]-gm1*val_velocity[BATCH_SIZE+iLane]/rhoxc;
+      val_invp_tensor[23*BATCH_SIZE+iLane]=-val_normal[2*BATCH_SIZE+iLane] / val_density[iLane]-gm1*val_velocity[2*BATCH_SIZE+iLane]/rhoxc;
+      val_invp_tensor[24*BATCH_SIZE+iLane]=Gamma_Minus_One/rhoxc;
+      
+    }
+    if (nDim == 2) {
+      
+      sqvel = val_velocity[iLane]*val_velocity[iLane]+val_velocity[BATCH_SIZE+iLane]*val_velocity[BATCH_SIZE+iLane];
+
+      val_invp_tensor[iLane] = 1.0-0.5*gm1_o_c2*sqvel;
+      val_invp_tensor[BATCH_SIZE+iLane]=gm1_o_c2*val_velocity[iLane];
+      val_invp_tensor[2*BATCH_SIZE+iLane]=gm1_o_c2*val_velocity[BATCH_SIZE+iLane];
+      val_invp_tensor[3*BATCH_SIZE+iLane]=-gm1_o_c2;
+
+      val_invp_tensor[4*BATCH_SIZE+iLane]=-k1orho*val_velocity[iLane]+k0orho*val_velocity[BATCH_SIZE+iLane];
+      val_invp_tensor[5*BATCH_SIZE+iLane]=k1orho;
+      val_invp_tensor[6*BATCH_SIZE+iLane]=-k0orho;
+      val_invp_tensor[7*BATCH_SIZE+iLane]=0.0;
+
+      val_invp_tensor[8*BATCH_SIZE+iLane]=-k0orho*val_velocity[iLane]-k1orho*val_velocity[BATCH_SIZE+iLane]+0.5*gm1_o_rhoxc*sqvel;
+      val_invp_tensor[9*BATCH_SIZE+iLane]=k0orho-gm1_o_rhoxc*val_velocity[iLane];
+      val_invp_tensor[10*BATCH_SIZE+iLane]=k1orho-gm1_o_rhoxc*val_velocity[BATCH_SIZE+iLane];
+      val_invp_tensor[11*BATCH_SIZE+iLane]=gm1_o_rhoxc;
+
+      val_invp_tensor[12*BATCH_SIZE+iLane]=k0orho*val_velocity[iLane]+k1orho*val_velocity[BATCH_SIZE+iLane]+0.5*gm1_o_rhoxc*sqvel;
+      val_invp_tensor[13*BATCH_SIZE+iLane]=-k0orho-gm1_o_rhoxc*val_velocity[iLane];
+      val_invp_tensor[14*BATCH_SIZE+iLane]=-k1orho-gm1_o_rhoxc*val_velocity[BATCH_SIZE+iLane];
+      val_invp_tensor[15*BATCH_SIZE+iLane]=gm1_o_rhoxc;
+      
+    }
+  }
+  
+}
+
 void CNumerics::GetPMatrix_inv(su2double **val_invp_tensor, su2double *val_density, su2double *val_velocity,
     su2double *val_soundspeed, su2double *val_chi, su2double *val_kappa, su2double *val_normal) {
 
@@ -2068,6 +2520,239 @@ void CNumerics::GetViscousProjJacs(su2double *val_Mean_PrimVar, su2double val_la
 
 }
 
+template<unsigned short nDim_>
+void CNumerics::GetViscousResidual_Batch_Dim(CNumericsBatch *val_batch, bool val_correct, bool val_implicit) {
+  
+  const unsigned short nVar_ = nDim_+2;
+  
+  unsigned short iVar, iDim, jDim, iLane;
+  su2double *V_i = val_batch->V_i, *V_j = val_batch->V_j, *Normal = val_batch->Normal,
+  *Coord_i = val_batch->Coord_i, *Coord_j = val_batch->Coord_j,
+  *PrimVar_Grad_i = val_batch->PrimVar_Grad_i, *PrimVar_Grad_j = val_batch->PrimVar_Grad_j,
+  *TurbKE_i = val_batch->TurbKE_i, *TurbKE_j = val_batch->TurbKE_j,
+  *Residual = val_batch->Residual, *Jacobian_i = val_batch->Jacobian_i, *Jacobian_j = val_batch->Jacobian_j;
+  
+  su2double Unit_Normal[nDim_*BATCH_SIZE], Edge_Vector[nDim_*BATCH_SIZE], Mean_PrimVar[(nDim_+3)*BATCH_SIZE],
+  Mean_GradPrimVar[(nDim_+1)*nDim_*BATCH_SIZE], Tau[nDim_*nDim_*BATCH_SIZE], Heat_Flux[nDim_*BATCH_SIZE],
+  Theta_Eta[nDim_*nDim_*BATCH_SIZE], Pi[nDim_*BATCH_SIZE],
+  Area_Lane[BATCH_SIZE], Dist_2[BATCH_SIZE], Mean_Lam_Visc[BATCH_SIZE], Mean_Eddy_Visc[BATCH_SIZE], Mean_TurbKE[BATCH_SIZE],
+  Total_Visc[BATCH_SIZE], Heat_Flux_Factor[BATCH_SIZE], Div_Vel[BATCH_SIZE], Proj_Grad_Edge[BATCH_SIZE],
+  Theta[BATCH_SIZE], SqVel[BATCH_SIZE], Proj_Flux_Vel[BATCH_SIZE], Factor[BATCH_SIZE], Rhoovisc[BATCH_SIZE],
+  Phi[BATCH_SIZE], Phi_Rho[BATCH_SIZE], Phi_P[BATCH_SIZE], Pi_Vel[BATCH_SIZE];
+  su2double Density, Pressure, Viscous_Factor, cpoR = Gamma/(Gamma-1.0), Cp = (Gamma / Gamma_Minus_One) * Gas_Constant;
+  
+  /*--- Same operations, in the same order, as CAvgGrad_Flow and CAvgGradCorrected_Flow
+   (GetViscousProjFlux and GetViscousProjJacs) for each lane of the pack, each loop
+   is over the lanes and the number of dimensions is fixed at compile time ---*/
+  
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    Area_Lane[iLane] = 0.0; Dist_2[iLane] = 0.0;
+  }
+  for (iDim = 0; iDim < nDim_; iDim++) {
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+      Area_Lane[iLane] += Normal[iDim*BATCH_SIZE+iLane]*Normal[iDim*BATCH_SIZE+iLane];
+      Edge_Vector[iDim*BATCH_SIZE+iLane] = Coord_j[iDim*BATCH_SIZE+iLane]-Coord_i[iDim*BATCH_SIZE+iLane];
+      Dist_2[iLane] += Edge_Vector[iDim*BATCH_SIZE+iLane]*Edge_Vector[iDim*BATCH_SIZE+iLane];
+    }
+  }
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+    Area_Lane[iLane] = sqrt(Area_Lane[iLane]);
+  for (iDim = 0; iDim < nDim_; iDim++)
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Unit_Normal[iDim*BATCH_SIZE+iLane] = Normal[iDim*BATCH_SIZE+iLane]/Area_Lane[iLane];
+  
+  /*--- Mean primitive variables, viscosities and turbulent kinetic energy ---*/
+  
+  for (iVar = 0; iVar < nDim_+3; iVar++)
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Mean_PrimVar[iVar*BATCH_SIZE+iLane] = 0.5*(V_i[iVar*BATCH_SIZE+iLane]+V_j[iVar*BATCH_SIZE+iLane]);
+  
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    Mean_Lam_Visc[iLane] = 0.5*(V_i[(nDim_+5)*BATCH_SIZE+iLane] + V_j[(nDim_+5)*BATCH_SIZE+iLane]);
+    Mean_Eddy_Visc[iLane] = 0.5*(V_i[(nDim_+6)*BATCH_SIZE+iLane] + V_j[(nDim_+6)*BATCH_SIZE+iLane]);
+    Mean_TurbKE[iLane] = 0.5*(TurbKE_i[iLane] + TurbKE_j[iLane]);
+  }
+  
+  /*--- Mean gradient, corrected with the difference along the edge ---*/
+  
+  for (iVar = 0; iVar < nDim_+1; iVar++) {
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Proj_Grad_Edge[iLane] = 0.0;
+    for (iDim = 0; iDim < nDim_; iDim++) {
+      for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+        Mean_GradPrimVar[(iVar*nDim_+iDim)*BATCH_SIZE+iLane] = 0.5*(PrimVar_Grad_i[(iVar*nDim_+iDim)*BATCH_SIZE+iLane] +
+                                                                    PrimVar_Grad_j[(iVar*nDim_+iDim)*BATCH_SIZE+iLane]);
+        Proj_Grad_Edge[iLane] += Mean_GradPrimVar[(iVar*nDim_+iDim)*BATCH_SIZE+iLane]*Edge_Vector[iDim*BATCH_SIZE+iLane];
+      }
+    }
+    if (val_correct) {
+      for (iDim = 0; iDim < nDim_; iDim++) {
+        for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+          su2double &Mean_Grad = Mean_GradPrimVar[(iVar*nDim_+iDim)*BATCH_SIZE+iLane];
+          Mean_Grad = (Dist_2[iLane] != 0.0)? Mean_Grad - (Proj_Grad_Edge[iLane] -
+                      (V_j[iVar*BATCH_SIZE+iLane]-V_i[iVar*BATCH_SIZE+iLane]))*Edge_Vector[iDim*BATCH_SIZE+iLane] / Dist_2[iLane] : Mean_Grad;
+        }
+      }
+    }
+  }
+  
+  /*--- Stress tensor and heat flux ---*/
+  
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    Total_Visc[iLane] = Mean_Lam_Visc[iLane] + Mean_Eddy_Visc[iLane];
+    Heat_Flux_Factor[iLane] = Cp * (Mean_Lam_Visc[iLane]/Prandtl_Lam + Mean_Eddy_Visc[iLane]/Prandtl_Turb);
+    Div_Vel[iLane] = 0.0;
+  }
+  for (iDim = 0; iDim < nDim_; iDim++)
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Div_Vel[iLane] += Mean_GradPrimVar[((iDim+1)*nDim_+iDim)*BATCH_SIZE+iLane];
+  
+  for (iDim = 0; iDim < nDim_; iDim++) {
+    for (jDim = 0; jDim < nDim_; jDim++) {
+      for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+        Tau[(iDim*nDim_+jDim)*BATCH_SIZE+iLane] = Total_Visc[iLane]*( Mean_GradPrimVar[((jDim+1)*nDim_+iDim)*BATCH_SIZE+iLane] +
+                                                                      Mean_GradPrimVar[((iDim+1)*nDim_+jDim)*BATCH_SIZE+iLane] );
+        if (iDim == jDim)
+          Tau[(iDim*nDim_+jDim)*BATCH_SIZE+iLane] = Tau[(iDim*nDim_+jDim)*BATCH_SIZE+iLane]
+          - TWO3*Total_Visc[iLane]*Div_Vel[iLane] - TWO3*Mean_PrimVar[(nDim_+2)*BATCH_SIZE+iLane]*Mean_TurbKE[iLane];
+      }
+    }
+  }
+  
+  for (iDim = 0; iDim < nDim_; iDim++) {
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Heat_Flux[iDim*BATCH_SIZE+iLane] = Tau[(iDim*nDim_)*BATCH_SIZE+iLane]*Mean_PrimVar[BATCH_SIZE+iLane];
+    for (jDim = 1; jDim < nDim_; jDim++)
+      for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+        Heat_Flux[iDim*BATCH_SIZE+iLane] += Tau[(iDim*nDim_+jDim)*BATCH_SIZE+iLane]*Mean_PrimVar[(jDim+1)*BATCH_SIZE+iLane];
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Heat_Flux[iDim*BATCH_SIZE+iLane] += Heat_Flux_Factor[iLane]*Mean_GradPrimVar[iDim*BATCH_SIZE+iLane];
+  }
+  
+  /*--- Projected flux ---*/
+  
+  for (iVar = 0; iVar < nVar_; iVar++)
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Residual[iVar*BATCH_SIZE+iLane] = 0.0;
+  for (iVar = 1; iVar < nDim_+1; iVar++)
+    for (iDim = 0; iDim < nDim_; iDim++)
+      for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+        Residual[iVar*BATCH_SIZE+iLane] += Tau[(iDim*nDim_+iVar-1)*BATCH_SIZE+iLane]*Normal[iDim*BATCH_SIZE+iLane];
+  for (iDim = 0; iDim < nDim_; iDim++)
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Residual[(nDim_+1)*BATCH_SIZE+iLane] += Heat_Flux[iDim*BATCH_SIZE+iLane]*Normal[iDim*BATCH_SIZE+iLane];
+  
+  if (!val_implicit) return;
+  
+  /*--- TSL-Approximation of the Jacobians ---*/
+  
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    Theta[iLane] = 0.0; SqVel[iLane] = 0.0; Proj_Flux_Vel[iLane] = 0.0;
+  }
+  for (iDim = 0; iDim < nDim_; iDim++) {
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+      Theta[iLane] += Unit_Normal[iDim*BATCH_SIZE+iLane]*Unit_Normal[iDim*BATCH_SIZE+iLane];
+      SqVel[iLane] += Mean_PrimVar[(iDim+1)*BATCH_SIZE+iLane]*Mean_PrimVar[(iDim+1)*BATCH_SIZE+iLane];
+      Proj_Flux_Vel[iLane] += Residual[(iDim+1)*BATCH_SIZE+iLane]*Mean_PrimVar[(iDim+1)*BATCH_SIZE+iLane];
+    }
+  }
+  
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    Density = Mean_PrimVar[(nDim_+2)*BATCH_SIZE+iLane];
+    Pressure = Mean_PrimVar[(nDim_+1)*BATCH_SIZE+iLane];
+    Viscous_Factor = Mean_Lam_Visc[iLane]/Prandtl_Lam + Mean_Eddy_Visc[iLane]/Prandtl_Turb;
+    Phi[iLane] = 0.5*(Gamma-1.0)*SqVel[iLane];
+    Factor[iLane] = Total_Visc[iLane]*Area_Lane[iLane]/(Density*sqrt(Dist_2[iLane]));
+    Phi_Rho[iLane] = -cpoR*Viscous_Factor*Pressure/(Density*Density);
+    Phi_P[iLane] = cpoR*Viscous_Factor/(Density);
+    Rhoovisc[iLane] = Density/(Total_Visc[iLane]);
+  }
+  
+  /*--- Symmetric matrix with the thetas on the diagonal and the etas off it ---*/
+  
+  for (iDim = 0; iDim < nDim_; iDim++) {
+    for (jDim = 0; jDim < nDim_; jDim++) {
+      for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+        if (iDim == jDim)
+          Theta_Eta[(iDim*nDim_+jDim)*BATCH_SIZE+iLane] = Theta[iLane] +
+          Unit_Normal[iDim*BATCH_SIZE+iLane]*Unit_Normal[iDim*BATCH_SIZE+iLane]/3.0;
+        else
+          Theta_Eta[(iDim*nDim_+jDim)*BATCH_SIZE+iLane] = Unit_Normal[iDim*BATCH_SIZE+iLane]*Unit_Normal[jDim*BATCH_SIZE+iLane]/3.0;
+      }
+    }
+  }
+  
+  for (iDim = 0; iDim < nDim_; iDim++) {
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Pi[iDim*BATCH_SIZE+iLane] = Mean_PrimVar[BATCH_SIZE+iLane]*Theta_Eta[iDim*BATCH_SIZE+iLane];
+    for (jDim = 1; jDim < nDim_; jDim++)
+      for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+        Pi[iDim*BATCH_SIZE+iLane] += Mean_PrimVar[(jDim+1)*BATCH_SIZE+iLane]*Theta_Eta[(jDim*nDim_+iDim)*BATCH_SIZE+iLane];
+  }
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+    Pi_Vel[iLane] = Pi[iLane]*Mean_PrimVar[BATCH_SIZE+iLane];
+  for (iDim = 1; iDim < nDim_; iDim++)
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Pi_Vel[iLane] += Pi[iDim*BATCH_SIZE+iLane]*Mean_PrimVar[(iDim+1)*BATCH_SIZE+iLane];
+  
+  /*--- Jacobian w.r.t. point i, the first row and the last column are zero ---*/
+  
+  for (iVar = 0; iVar < nVar_; iVar++) {
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+      Jacobian_i[iVar*BATCH_SIZE+iLane] = 0.0;
+      Jacobian_i[(iVar*nVar_+nVar_-1)*BATCH_SIZE+iLane] = 0.0;
+    }
+  }
+  for (iDim = 0; iDim < nDim_; iDim++) {
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Jacobian_i[((iDim+1)*nVar_)*BATCH_SIZE+iLane] = Factor[iLane]*Pi[iDim*BATCH_SIZE+iLane];
+    for (jDim = 0; jDim < nDim_; jDim++)
+      for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+        Jacobian_i[((iDim+1)*nVar_+jDim+1)*BATCH_SIZE+iLane] = -Factor[iLane]*Theta_Eta[(iDim*nDim_+jDim)*BATCH_SIZE+iLane];
+  }
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    Jacobian_i[((nVar_-1)*nVar_)*BATCH_SIZE+iLane] = -Factor[iLane]*(Rhoovisc[iLane]*Theta[iLane]*(Phi_Rho[iLane]+Phi[iLane]*Phi_P[iLane]) - Pi_Vel[iLane]);
+    Jacobian_i[((nVar_-1)*nVar_+nVar_-1)*BATCH_SIZE+iLane] = -Factor[iLane]*((Gamma-1.0)*Rhoovisc[iLane]*Theta[iLane]*Phi_P[iLane]);
+  }
+  for (iDim = 0; iDim < nDim_; iDim++)
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Jacobian_i[((nVar_-1)*nVar_+iDim+1)*BATCH_SIZE+iLane] = -Factor[iLane]*(Pi[iDim*BATCH_SIZE+iLane] -
+      Rhoovisc[iLane]*Theta[iLane]*Phi_P[iLane]*(Gamma-1.0)*Mean_PrimVar[(iDim+1)*BATCH_SIZE+iLane]);
+  
+  for (iVar = 0; iVar < nVar_*nVar_; iVar++)
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++)
+      Jacobian_j[iVar*BATCH_SIZE+iLane] = -Jacobian_i[iVar*BATCH_SIZE+iLane];
+  
+  /*--- Contribution of the projected flux to the energy row ---*/
+  
+  for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+    Viscous_Factor = 0.5/Mean_PrimVar[(nDim_+2)*BATCH_SIZE+iLane];
+    Jacobian_i[((nVar_-1)*nVar_)*BATCH_SIZE+iLane] += Viscous_Factor*Proj_Flux_Vel[iLane];
+    Jacobian_j[((nVar_-1)*nVar_)*BATCH_SIZE+iLane] += Viscous_Factor*Proj_Flux_Vel[iLane];
+    for (iDim = 0; iDim < nDim_; iDim++) {
+      Jacobian_i[((nVar_-1)*nVar_+iDim+1)*BATCH_SIZE+iLane] += Viscous_Factor*Residual[(iDim+1)*BATCH_SIZE+iLane];
+      Jacobian_j[((nVar_-1)*nVar_+iDim+1)*BATCH_SIZE+iLane] += Viscous_Factor*Residual[(iDim+1)*BATCH_SIZE+iLane];
+    }
+  }
+  
+  /*--- Points at the same location have no Jacobian ---*/
+  
+  for (iVar = 0; iVar < nVar_*nVar_; iVar++) {
+    for (iLane = 0; iLane < BATCH_SIZE; iLane++) {
+      Jacobian_i[iVar*BATCH_SIZE+iLane] = (Dist_2[iLane] != 0.0)? Jacobian_i[iVar*BATCH_SIZE+iLane] : 0.0;
+      Jacobian_j[iVar*BATCH_SIZE+iLane] = (Dist_2[iLane] != 0.0)? Jacobian_j[iVar*BATCH_SIZE+iLane] : 0.0;
+    }
+  }
+  
+}
+
+void CNumerics::GetViscousResidual_Batch(CNumericsBatch *val_batch, bool val_correct, bool val_implicit) {
+  
+  if (nDim == 2) GetViscousResidual_Batch_Dim<2>(val_batch, val_correct, val_implicit);
+  else GetViscousResidual_Batch_Dim<3>(val_batch, val_correct, val_implicit);
+  
+}
+
 void CNumerics::GetViscousProjJacs(su2double *val_Mean_PrimVar,
                   su2double **val_gradprimvar,
                   su2double *val_Mean_SecVar,
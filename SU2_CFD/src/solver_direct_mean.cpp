@@ -39,6 +39,14 @@
 
 CEulerSolver::CEulerSolver(void) : CSolver() {
   
+  /*--- The momentum components are rotated in the periodic halo exchanges ---*/
+
+  Periodic_Vectors = true;
+
+  /*--- The gradient only accumulates the limiter bounds when requested in Preprocessing ---*/
+
+  Fused_Limiter_Bounds = false;
+
   /*--- Basic array initialization ---*/
   
   CD_Inv = NULL; CL_Inv = NULL; CSF_Inv = NULL;  CEff_Inv = NULL;
@@ -222,6 +230,14 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
 
   /*--- Array initialization ---*/
 
+  /*--- The momentum components are rotated in the periodic halo exchanges ---*/
+
+  Periodic_Vectors = true;
+
+  /*--- The gradient only accumulates the limiter bounds when requested in Preprocessing ---*/
+
+  Fused_Limiter_Bounds = false;
+
   /*--- Basic array initialization ---*/
 
   CD_Inv = NULL; CL_Inv = NULL; CSF_Inv = NULL;  CEff_Inv = NULL;
@@ -804,6 +820,10 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
   for (iPoint = 0; iPoint < nPoint; iPoint++)
     node[iPoint] = new CEulerVariable(Density_Inf, Velocity_Inf, Energy_Inf, nDim, nVar, config);
 
+  /*--- Store the fields of all the points contiguously ---*/
+
+  SetVariable_Storage(nPrimVar, nPrimVarGrad, nSecondaryVar);
+
   /*--- Check that the initial solution is physical, report any non-physical nodes ---*/
 
   counter_local = 0;
@@ -1501,1014 +1521,91 @@ void CEulerSolver::InitTurboContainers(CGeometry *geometry, CConfig *config){
     CkOutflow1= new complex<su2double>** [nMarker];
     CkOutflow2= new complex<su2double>** [nMarker];
 
-    for (iMarker = 0; iMarker < nMarker; iMarker++) {
-      CkInflow[iMarker]= new complex<su2double>*[nSpanWiseSections];
-      CkOutflow1[iMarker]= new complex<su2double>*[nSpanWiseSections];
-      CkOutflow2[iMarker]= new complex<su2double>*[nSpanWiseSections];
-
-      for(iSpan = 0; iSpan < nSpanWiseSections; iSpan++) {
-        CkInflow[iMarker][iSpan]= new complex<su2double>[2*geometry->GetnFreqSpanMax(INFLOW)+1];
-        CkOutflow1[iMarker][iSpan]= new complex<su2double>[2*geometry->GetnFreqSpanMax(OUTFLOW)+1];
-        CkOutflow2[iMarker][iSpan]= new complex<su2double>[2*geometry->GetnFreqSpanMax(OUTFLOW)+1];
-
-        for (iVar = 0; iVar <2*geometry->GetnFreqSpanMax(INFLOW)+1; iVar++) {
-          CkInflow[iMarker][iSpan][iVar]= complex<su2double>(0.0,0.0);
-        }
-
-        for (iVar = 0; iVar <2*geometry->GetnFreqSpanMax(OUTFLOW)+1; iVar++) {
-          CkOutflow1[iMarker][iSpan][iVar]= complex<su2double>(0.0,0.0);
-          CkOutflow2[iMarker][iSpan][iVar]= complex<su2double>(0.0,0.0);
-        }
-      }
-    }
-  }
-
-
-}
-
-void CEulerSolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi, *Buffer_Receive_U = NULL, *Buffer_Send_U = NULL;
-  
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
-  
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar;        nBufferR_Vector = nVertexR*nVar;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_U = new su2double [nBufferR_Vector];
-      Buffer_Send_U = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Send_U[iVar*nVertexS+iVertex] = node[iPoint]->GetSolution(iVar);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_U, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Receive_U[iVar*nVertexR+iVertex] = Buffer_Send_U[iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_U;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
-        
-        /*--- Retrieve the supplied periodic information. ---*/
-        angles = config->GetPeriodicRotation(iPeriodic_Index);
-        
-        /*--- Store angles separately for clarity. ---*/
-        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
-        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-        
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis,
-         then z-axis. Note that this is the transpose of the matrix
-         used during the preprocessing stage. ---*/
-        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
-        
-        /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          Solution[iVar] = Buffer_Receive_U[iVar*nVertexR+iVertex];
-        
-        /*--- Rotate the momentum components. ---*/
-        if (nDim == 2) {
-          Solution[1] = rotMatrix[0][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_U[2*nVertexR+iVertex];
-          Solution[2] = rotMatrix[1][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_U[2*nVertexR+iVertex];
-        }
-        else {
-          Solution[1] = rotMatrix[0][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_U[2*nVertexR+iVertex] +
-          rotMatrix[0][2]*Buffer_Receive_U[3*nVertexR+iVertex];
-          Solution[2] = rotMatrix[1][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_U[2*nVertexR+iVertex] +
-          rotMatrix[1][2]*Buffer_Receive_U[3*nVertexR+iVertex];
-          Solution[3] = rotMatrix[2][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[2][1]*Buffer_Receive_U[2*nVertexR+iVertex] +
-          rotMatrix[2][2]*Buffer_Receive_U[3*nVertexR+iVertex];
-        }
-        
-        /*--- Copy transformed conserved variables back into buffer. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          node[iPoint]->SetSolution(iVar, Solution[iVar]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_U;
-      
-    }
-    
-  }
-  
-}
-
-void CEulerSolver::Set_MPI_Solution_Old(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
-  *Buffer_Receive_U = NULL, *Buffer_Send_U = NULL;
-  
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
-  
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar;        nBufferR_Vector = nVertexR*nVar;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_U = new su2double [nBufferR_Vector];
-      Buffer_Send_U = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Send_U[iVar*nVertexS+iVertex] = node[iPoint]->GetSolution_Old(iVar);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_U, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Receive_U[iVar*nVertexR+iVertex] = Buffer_Send_U[iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_U;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
-        
-        /*--- Retrieve the supplied periodic information. ---*/
-        angles = config->GetPeriodicRotation(iPeriodic_Index);
-        
-        /*--- Store angles separately for clarity. ---*/
-        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
-        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-        
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis,
-         then z-axis. Note that this is the transpose of the matrix
-         used during the preprocessing stage. ---*/
-        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
-        
-        /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          Solution[iVar] = Buffer_Receive_U[iVar*nVertexR+iVertex];
-        
-        /*--- Rotate the momentum components. ---*/
-        if (nDim == 2) {
-          Solution[1] = rotMatrix[0][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_U[2*nVertexR+iVertex];
-          Solution[2] = rotMatrix[1][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_U[2*nVertexR+iVertex];
-        }
-        else {
-          Solution[1] = rotMatrix[0][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_U[2*nVertexR+iVertex] +
-          rotMatrix[0][2]*Buffer_Receive_U[3*nVertexR+iVertex];
-          Solution[2] = rotMatrix[1][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_U[2*nVertexR+iVertex] +
-          rotMatrix[1][2]*Buffer_Receive_U[3*nVertexR+iVertex];
-          Solution[3] = rotMatrix[2][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[2][1]*Buffer_Receive_U[2*nVertexR+iVertex] +
-          rotMatrix[2][2]*Buffer_Receive_U[3*nVertexR+iVertex];
-        }
-        
-        /*--- Copy transformed conserved variables back into buffer. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          node[iPoint]->SetSolution_Old(iVar, Solution[iVar]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_U;
-      
-    }
-    
-  }
-}
-
-void CEulerSolver::Set_MPI_Undivided_Laplacian(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
-  *Buffer_Receive_Undivided_Laplacian = NULL, *Buffer_Send_Undivided_Laplacian = NULL;
-  
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
-  
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar;        nBufferR_Vector = nVertexR*nVar;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Undivided_Laplacian = new su2double [nBufferR_Vector];
-      Buffer_Send_Undivided_Laplacian = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Send_Undivided_Laplacian[iVar*nVertexS+iVertex] = node[iPoint]->GetUndivided_Laplacian(iVar);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Undivided_Laplacian, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_Undivided_Laplacian, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Receive_Undivided_Laplacian[iVar*nVertexR+iVertex] = Buffer_Send_Undivided_Laplacian[iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Undivided_Laplacian;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
-        
-        /*--- Retrieve the supplied periodic information. ---*/
-        angles = config->GetPeriodicRotation(iPeriodic_Index);
-        
-        /*--- Store angles separately for clarity. ---*/
-        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
-        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-        
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis,
-         then z-axis. Note that this is the transpose of the matrix
-         used during the preprocessing stage. ---*/
-        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
-        
-        /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          Solution[iVar] = Buffer_Receive_Undivided_Laplacian[iVar*nVertexR+iVertex];
-        
-        /*--- Rotate the momentum components. ---*/
-        if (nDim == 2) {
-          Solution[1] = rotMatrix[0][0]*Buffer_Receive_Undivided_Laplacian[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_Undivided_Laplacian[2*nVertexR+iVertex];
-          Solution[2] = rotMatrix[1][0]*Buffer_Receive_Undivided_Laplacian[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_Undivided_Laplacian[2*nVertexR+iVertex];
-        }
-        else {
-          Solution[1] = rotMatrix[0][0]*Buffer_Receive_Undivided_Laplacian[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_Undivided_Laplacian[2*nVertexR+iVertex] +
-          rotMatrix[0][2]*Buffer_Receive_Undivided_Laplacian[3*nVertexR+iVertex];
-          Solution[2] = rotMatrix[1][0]*Buffer_Receive_Undivided_Laplacian[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_Undivided_Laplacian[2*nVertexR+iVertex] +
-          rotMatrix[1][2]*Buffer_Receive_Undivided_Laplacian[3*nVertexR+iVertex];
-          Solution[3] = rotMatrix[2][0]*Buffer_Receive_Undivided_Laplacian[1*nVertexR+iVertex] +
-          rotMatrix[2][1]*Buffer_Receive_Undivided_Laplacian[2*nVertexR+iVertex] +
-          rotMatrix[2][2]*Buffer_Receive_Undivided_Laplacian[3*nVertexR+iVertex];
-        }
-        
-        /*--- Copy transformed conserved variables back into buffer. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          node[iPoint]->SetUndivided_Laplacian(iVar, Solution[iVar]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Undivided_Laplacian;
-      
-    }
-    
-  }
-  
-}
-
-void CEulerSolver::Set_MPI_MaxEigenvalue(CGeometry *geometry, CConfig *config) {
-  unsigned short iMarker, MarkerS, MarkerR, *Buffer_Receive_Neighbor = NULL, *Buffer_Send_Neighbor = NULL;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double *Buffer_Receive_Lambda = NULL, *Buffer_Send_Lambda = NULL;
-  
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
-  
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS;        nBufferR_Vector = nVertexR;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Lambda = new su2double [nBufferR_Vector];
-      Buffer_Send_Lambda = new su2double[nBufferS_Vector];
-      Buffer_Receive_Neighbor = new unsigned short [nBufferR_Vector];
-      Buffer_Send_Neighbor = new unsigned short[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        Buffer_Send_Lambda[iVertex] = node[iPoint]->GetLambda();
-        Buffer_Send_Neighbor[iVertex] = geometry->node[iPoint]->GetnPoint();
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Lambda, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_Lambda, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      SU2_MPI::Sendrecv(Buffer_Send_Neighbor, nBufferS_Vector, MPI_UNSIGNED_SHORT, send_to, 1,
-                        Buffer_Receive_Neighbor, nBufferR_Vector, MPI_UNSIGNED_SHORT, receive_from, 1, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        Buffer_Receive_Lambda[iVertex] = Buffer_Send_Lambda[iVertex];
-        Buffer_Receive_Neighbor[iVertex] = Buffer_Send_Neighbor[iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Lambda;
-      delete [] Buffer_Send_Neighbor;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        node[iPoint]->SetLambda(Buffer_Receive_Lambda[iVertex]);
-        geometry->node[iPoint]->SetnNeighbor(Buffer_Receive_Neighbor[iVertex]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Lambda;
-      delete [] Buffer_Receive_Neighbor;
-      
-    }
-    
-  }
-}
-
-void CEulerSolver::Set_MPI_Sensor(CGeometry *geometry, CConfig *config) {
-  unsigned short iMarker, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double *Buffer_Receive_Lambda = NULL, *Buffer_Send_Lambda = NULL;
-  
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
-  
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS;        nBufferR_Vector = nVertexR;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Lambda = new su2double [nBufferR_Vector];
-      Buffer_Send_Lambda = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        Buffer_Send_Lambda[iVertex] = node[iPoint]->GetSensor();
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Lambda, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_Lambda, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        Buffer_Receive_Lambda[iVertex] = Buffer_Send_Lambda[iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Lambda;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        node[iPoint]->SetSensor(Buffer_Receive_Lambda[iVertex]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Lambda;
-      
-    }
-    
-  }
-}
-
-void CEulerSolver::Set_MPI_Solution_Gradient(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iDim, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
-  *Buffer_Receive_Gradient = NULL, *Buffer_Send_Gradient = NULL;
-  
-  su2double **Gradient = new su2double* [nVar];
-  for (iVar = 0; iVar < nVar; iVar++)
-    Gradient[iVar] = new su2double[nDim];
-  
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
-  
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar*nDim;        nBufferR_Vector = nVertexR*nVar*nDim;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Gradient = new su2double [nBufferR_Vector];
-      Buffer_Send_Gradient = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Buffer_Send_Gradient[iDim*nVar*nVertexS+iVar*nVertexS+iVertex] = node[iPoint]->GetGradient(iVar, iDim);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Gradient, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_Gradient, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Buffer_Receive_Gradient[iDim*nVar*nVertexR+iVar*nVertexR+iVertex] = Buffer_Send_Gradient[iDim*nVar*nVertexR+iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Gradient;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
-        
-        /*--- Retrieve the supplied periodic information. ---*/
-        angles = config->GetPeriodicRotation(iPeriodic_Index);
-        
-        /*--- Store angles separately for clarity. ---*/
-        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
-        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-        
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis,
-         then z-axis. Note that this is the transpose of the matrix
-         used during the preprocessing stage. ---*/
-        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
-        
-        /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Gradient[iVar][iDim] = Buffer_Receive_Gradient[iDim*nVar*nVertexR+iVar*nVertexR+iVertex];
-        
-        /*--- Need to rotate the gradients for all conserved variables. ---*/
-        for (iVar = 0; iVar < nVar; iVar++) {
-          if (nDim == 2) {
-            Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex];
-          }
-          else {
-            Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][2]*Buffer_Receive_Gradient[2*nVar*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][2]*Buffer_Receive_Gradient[2*nVar*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][2] = rotMatrix[2][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[2][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[2][2]*Buffer_Receive_Gradient[2*nVar*nVertexR+iVar*nVertexR+iVertex];
-          }
-        }
-        
-        /*--- Store the received information ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            node[iPoint]->SetGradient(iVar, iDim, Gradient[iVar][iDim]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Gradient;
-      
-    }
-    
-  }
-  
-  for (iVar = 0; iVar < nVar; iVar++)
-    delete [] Gradient[iVar];
-  delete [] Gradient;
-  
-}
-
-void CEulerSolver::Set_MPI_Solution_Limiter(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
-  *Buffer_Receive_Limit = NULL, *Buffer_Send_Limit = NULL;
-  
-  su2double *Limiter = new su2double [nVar];
-  
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
-  
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar;        nBufferR_Vector = nVertexR*nVar;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Limit = new su2double [nBufferR_Vector];
-      Buffer_Send_Limit = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Send_Limit[iVar*nVertexS+iVertex] = node[iPoint]->GetLimiter(iVar);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Limit, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_Limit, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Receive_Limit[iVar*nVertexR+iVertex] = Buffer_Send_Limit[iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Limit;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
-        
-        /*--- Retrieve the supplied periodic information. ---*/
-        angles = config->GetPeriodicRotation(iPeriodic_Index);
-        
-        /*--- Store angles separately for clarity. ---*/
-        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
-        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-        
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis,
-         then z-axis. Note that this is the transpose of the matrix
-         used during the preprocessing stage. ---*/
-        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
-        
-        /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          Limiter[iVar] = Buffer_Receive_Limit[iVar*nVertexR+iVertex];
-        
-        /*--- Rotate the momentum components. ---*/
-        if (nDim == 2) {
-          Limiter[1] = rotMatrix[0][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_Limit[2*nVertexR+iVertex];
-          Limiter[2] = rotMatrix[1][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_Limit[2*nVertexR+iVertex];
+    for (iMarker = 0; iMarker < nMarker; iMarker++) {
+      CkInflow[iMarker]= new complex<su2double>*[nSpanWiseSections];
+      CkOutflow1[iMarker]= new complex<su2double>*[nSpanWiseSections];
+      CkOutflow2[iMarker]= new complex<su2double>*[nSpanWiseSections];
+
+      for(iSpan = 0; iSpan < nSpanWiseSections; iSpan++) {
+        CkInflow[iMarker][iSpan]= new complex<su2double>[2*geometry->GetnFreqSpanMax(INFLOW)+1];
+        CkOutflow1[iMarker][iSpan]= new complex<su2double>[2*geometry->GetnFreqSpanMax(OUTFLOW)+1];
+        CkOutflow2[iMarker][iSpan]= new complex<su2double>[2*geometry->GetnFreqSpanMax(OUTFLOW)+1];
+
+        for (iVar = 0; iVar <2*geometry->GetnFreqSpanMax(INFLOW)+1; iVar++) {
+          CkInflow[iMarker][iSpan][iVar]= complex<su2double>(0.0,0.0);
         }
-        else {
-          Limiter[1] = rotMatrix[0][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_Limit[2*nVertexR+iVertex] +
-          rotMatrix[0][2]*Buffer_Receive_Limit[3*nVertexR+iVertex];
-          Limiter[2] = rotMatrix[1][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_Limit[2*nVertexR+iVertex] +
-          rotMatrix[1][2]*Buffer_Receive_Limit[3*nVertexR+iVertex];
-          Limiter[3] = rotMatrix[2][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[2][1]*Buffer_Receive_Limit[2*nVertexR+iVertex] +
-          rotMatrix[2][2]*Buffer_Receive_Limit[3*nVertexR+iVertex];
+
+        for (iVar = 0; iVar <2*geometry->GetnFreqSpanMax(OUTFLOW)+1; iVar++) {
+          CkOutflow1[iMarker][iSpan][iVar]= complex<su2double>(0.0,0.0);
+          CkOutflow2[iMarker][iSpan][iVar]= complex<su2double>(0.0,0.0);
         }
-        
-        /*--- Copy transformed conserved variables back into buffer. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          node[iPoint]->SetLimiter(iVar, Limiter[iVar]);
-        
       }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Limit;
-      
     }
-    
   }
+
+
+}
+
+void CEulerSolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) {
   
-  delete [] Limiter;
+  InitiateComms(geometry, config, COMM_SOLUTION);
+  CompleteComms(geometry, config, COMM_SOLUTION);
   
 }
 
-void CEulerSolver::Set_MPI_Primitive_Gradient(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iDim, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
-  *Buffer_Receive_Gradient = NULL, *Buffer_Send_Gradient = NULL;
+void CEulerSolver::Set_MPI_Solution_Old(CGeometry *geometry, CConfig *config) {
   
-  su2double **Gradient = new su2double* [nPrimVarGrad];
-  for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-    Gradient[iVar] = new su2double[nDim];
+  InitiateComms(geometry, config, COMM_SOLUTION_OLD);
+  CompleteComms(geometry, config, COMM_SOLUTION_OLD);
   
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
+}
+
+void CEulerSolver::Set_MPI_Undivided_Laplacian(CGeometry *geometry, CConfig *config) {
   
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nPrimVarGrad*nDim;        nBufferR_Vector = nVertexR*nPrimVarGrad*nDim;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Gradient = new su2double [nBufferR_Vector];
-      Buffer_Send_Gradient = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Buffer_Send_Gradient[iDim*nPrimVarGrad*nVertexS+iVar*nVertexS+iVertex] = node[iPoint]->GetGradient_Primitive(iVar, iDim);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Gradient, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_Gradient, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Buffer_Receive_Gradient[iDim*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] = Buffer_Send_Gradient[iDim*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Gradient;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
-        
-        /*--- Retrieve the supplied periodic information. ---*/
-        angles = config->GetPeriodicRotation(iPeriodic_Index);
-        
-        /*--- Store angles separately for clarity. ---*/
-        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
-        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-        
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis,
-         then z-axis. Note that this is the transpose of the matrix
-         used during the preprocessing stage. ---*/
-        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
-        
-        /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Gradient[iVar][iDim] = Buffer_Receive_Gradient[iDim*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex];
-        
-        /*--- Need to rotate the gradients for all conserved variables. ---*/
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-          if (nDim == 2) {
-            Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Receive_Gradient[0*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][1]*Buffer_Receive_Gradient[1*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Receive_Gradient[0*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][1]*Buffer_Receive_Gradient[1*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex];
-          }
-          else {
-            Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Receive_Gradient[0*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][1]*Buffer_Receive_Gradient[1*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][2]*Buffer_Receive_Gradient[2*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Receive_Gradient[0*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][1]*Buffer_Receive_Gradient[1*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][2]*Buffer_Receive_Gradient[2*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][2] = rotMatrix[2][0]*Buffer_Receive_Gradient[0*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[2][1]*Buffer_Receive_Gradient[1*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[2][2]*Buffer_Receive_Gradient[2*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex];
-          }
-        }
-        
-        /*--- Store the received information ---*/
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            node[iPoint]->SetGradient_Primitive(iVar, iDim, Gradient[iVar][iDim]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Gradient;
-      
-    }
-    
-  }
+  InitiateComms(geometry, config, COMM_UNDIVIDED_LAPLACIAN);
+  CompleteComms(geometry, config, COMM_UNDIVIDED_LAPLACIAN);
+  
+}
+
+void CEulerSolver::Set_MPI_MaxEigenvalue(CGeometry *geometry, CConfig *config) {
   
-  for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-    delete [] Gradient[iVar];
-  delete [] Gradient;
+  InitiateComms(geometry, config, COMM_MAX_EIGENVALUE);
+  CompleteComms(geometry, config, COMM_MAX_EIGENVALUE);
   
 }
 
-void CEulerSolver::Set_MPI_Primitive_Limiter(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
-  *Buffer_Receive_Limit = NULL, *Buffer_Send_Limit = NULL;
+void CEulerSolver::Set_MPI_Sensor(CGeometry *geometry, CConfig *config) {
   
-  su2double *Limiter = new su2double [nPrimVarGrad];
+  InitiateComms(geometry, config, COMM_SENSOR);
+  CompleteComms(geometry, config, COMM_SENSOR);
   
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
+}
+
+void CEulerSolver::Set_MPI_Solution_Gradient(CGeometry *geometry, CConfig *config) {
   
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nPrimVarGrad;        nBufferR_Vector = nVertexR*nPrimVarGrad;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Limit = new su2double [nBufferR_Vector];
-      Buffer_Send_Limit = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          Buffer_Send_Limit[iVar*nVertexS+iVertex] = node[iPoint]->GetLimiter_Primitive(iVar);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Limit, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_Limit, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          Buffer_Receive_Limit[iVar*nVertexR+iVertex] = Buffer_Send_Limit[iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Limit;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
-        
-        /*--- Retrieve the supplied periodic information. ---*/
-        angles = config->GetPeriodicRotation(iPeriodic_Index);
-        
-        /*--- Store angles separately for clarity. ---*/
-        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
-        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-        
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis,
-         then z-axis. Note that this is the transpose of the matrix
-         used during the preprocessing stage. ---*/
-        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
-        
-        /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          Limiter[iVar] = Buffer_Receive_Limit[iVar*nVertexR+iVertex];
-        
-        /*--- Rotate the momentum components. ---*/
-        if (nDim == 2) {
-          Limiter[1] = rotMatrix[0][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_Limit[2*nVertexR+iVertex];
-          Limiter[2] = rotMatrix[1][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_Limit[2*nVertexR+iVertex];
-        }
-        else {
-          Limiter[1] = rotMatrix[0][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_Limit[2*nVertexR+iVertex] +
-          rotMatrix[0][2]*Buffer_Receive_Limit[3*nVertexR+iVertex];
-          Limiter[2] = rotMatrix[1][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_Limit[2*nVertexR+iVertex] +
-          rotMatrix[1][2]*Buffer_Receive_Limit[3*nVertexR+iVertex];
-          Limiter[3] = rotMatrix[2][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[2][1]*Buffer_Receive_Limit[2*nVertexR+iVertex] +
-          rotMatrix[2][2]*Buffer_Receive_Limit[3*nVertexR+iVertex];
-        }
-        
-        /*--- Copy transformed conserved variables back into buffer. ---*/
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          node[iPoint]->SetLimiter_Primitive(iVar, Limiter[iVar]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Limit;
-      
-    }
-    
-  }
+  InitiateComms(geometry, config, COMM_SOLUTION_GRADIENT);
+  CompleteComms(geometry, config, COMM_SOLUTION_GRADIENT);
+  
+}
+
+void CEulerSolver::Set_MPI_Solution_Limiter(CGeometry *geometry, CConfig *config) {
   
-  delete [] Limiter;
+  InitiateComms(geometry, config, COMM_SOLUTION_LIMITER);
+  CompleteComms(geometry, config, COMM_SOLUTION_LIMITER);
+  
+}
+
+void CEulerSolver::Set_MPI_Primitive_Gradient(CGeometry *geometry, CConfig *config) {
+  
+  InitiateComms(geometry, config, COMM_PRIMITIVE_GRADIENT);
+  CompleteComms(geometry, config, COMM_PRIMITIVE_GRADIENT);
+  
+}
+
+void CEulerSolver::Set_MPI_Primitive_Limiter(CGeometry *geometry, CConfig *config) {
+  
+  InitiateComms(geometry, config, COMM_PRIMITIVE_LIMITER);
+  CompleteComms(geometry, config, COMM_PRIMITIVE_LIMITER);
   
 }
 
@@ -4279,6 +3376,7 @@ void CEulerSolver::SetInitialCondition(CGeometry **geometry, CSolver ***solver_c
 void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
   
   unsigned long ErrorCounter = 0;
+  unsigned short nComm, commType[3];
   
   unsigned long ExtIter = config->GetExtIter();
   bool cont_adjoint     = config->GetContinuous_Adjoint();
@@ -4330,7 +3428,10 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
   
   if ((muscl && !center) && (iMesh == MESH_0) && !Output) {
     
-    /*--- Gradient computation ---*/
+    /*--- Gradient computation, the neighbor bounds of the limiter are
+     accumulated in the same pass over the grid ---*/
+    
+    Fused_Limiter_Bounds = (limiter && !van_albada);
     
     if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
       SetPrimitive_Gradient_GG(geometry, config);
@@ -4346,14 +3447,18 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
     
   }
   
-  /*--- Artificial dissipation ---*/
+  /*--- Artificial dissipation, the halo values of all its quantities
+   are exchanged in a single message per neighbor. ---*/
   
   if (center && !Output) {
-    SetMax_Eigenvalue(geometry, config);
+    nComm = 0;
+    SetMax_Eigenvalue(geometry, config); commType[nComm++] = COMM_MAX_EIGENVALUE;
     if ((center_jst) && (iMesh == MESH_0)) {
-      SetCentered_Dissipation_Sensor(geometry, config);
-      SetUndivided_Laplacian(geometry, config);
+      SetCentered_Dissipation_Sensor(geometry, config); commType[nComm++] = COMM_SENSOR;
+      SetUndivided_Laplacian(geometry, config); commType[nComm++] = COMM_UNDIVIDED_LAPLACIAN;
     }
+    InitiateComms(geometry, config, nComm, commType);
+    CompleteComms(geometry, config, nComm, commType);
   }
   
   /*--- Roe Low Dissipation Sensor ---*/
@@ -4598,57 +3703,131 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
 void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                                      CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
   
-  unsigned long iEdge, iPoint, jPoint;
-  
   bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
   bool jst_scheme = ((config->GetKind_Centered_Flow() == JST) && (iMesh == MESH_0));
   bool grid_movement = config->GetGrid_Movement();
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  /*--- The JST fluxes are computed in packs of edges when the scheme supports it ---*/
+  
+  bool batched = (config->GetBatched_Conv_Flow() && numerics->GetBatched() && jst_scheme && !config->GetAD_Mode());
+  
+  /*--- Edges of the same color do not share points, hence they are processed
+   concurrently when several threads are available. ---*/
+  
+  unsigned short nEdgeColor = geometry->GetnEdgeColor();
+  unsigned long *EdgeColor_Ptr = geometry->GetEdgeColor_Ptr(), *EdgeColor_Edge = geometry->GetEdgeColor_Edge();
+  bool threaded = (nEdgeColor > 1);
+  
+  SU2_OMP(parallel if(threaded))
+  {
     
-    /*--- Points in edge, set normal vectors, and number of neighbors ---*/
+    unsigned short iVar, iColor, iLane, iThread = OMP::GetThreadNum();
+    unsigned long iColorEdge, iEdge, iPoint, jPoint, *Nodes;
     
-    iPoint = geometry->edge[iEdge]->GetNode(0); jPoint = geometry->edge[iEdge]->GetNode(1);
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
-    numerics->SetNeighbor(geometry->node[iPoint]->GetnNeighbor(), geometry->node[jPoint]->GetnNeighbor());
+    /*--- Each thread uses its own numerics, pack of edges, and residual/Jacobian
+     containers (the first thread uses the ones of the solver) ---*/
     
-    /*--- Set primitive variables w/o reconstruction ---*/
+    CNumerics *edge_numerics = numerics->GetThread_Numerics(iThread);
     
-    numerics->SetPrimitive(node[iPoint]->GetPrimitive(), node[jPoint]->GetPrimitive());
+    CNumericsBatch *Batch = NULL;
+    if (batched) Batch = new CNumericsBatch(nDim, nVar, false);
     
-    /*--- Set the largest convective eigenvalue ---*/
+    su2double *Res = Res_Conv, **Jac_i = Jacobian_i, **Jac_j = Jacobian_j;
     
-    numerics->SetLambda(node[iPoint]->GetLambda(), node[jPoint]->GetLambda());
+    if (iThread > 0) {
+      Res   = new su2double[nVar];
+      Jac_i = new su2double*[nVar]; Jac_j = new su2double*[nVar];
+      for (iVar = 0; iVar < nVar; iVar++) {
+        Jac_i[iVar] = new su2double[nVar]; Jac_j[iVar] = new su2double[nVar];
+      }
+    }
     
-    /*--- Set undivided laplacian an pressure based sensor ---*/
+    for (iColor = 0; iColor < nEdgeColor; iColor++) {
+      
+      SU2_OMP(for schedule(static))
+      for (iColorEdge = EdgeColor_Ptr[iColor]; iColorEdge < EdgeColor_Ptr[iColor+1]; iColorEdge++) {
+        
+        iEdge = EdgeColor_Edge[iColorEdge];
     
-    if (jst_scheme) {
-      numerics->SetUndivided_Laplacian(node[iPoint]->GetUndivided_Laplacian(), node[jPoint]->GetUndivided_Laplacian());
-      numerics->SetSensor(node[iPoint]->GetSensor(), node[jPoint]->GetSensor());
-    }
+        /*--- Points in edge, set normal vectors, and number of neighbors ---*/
     
-    /*--- Grid movement ---*/
+        Nodes = geometry->GetEdge_Nodes(iEdge);
+        iPoint = Nodes[0]; jPoint = Nodes[1];
+        
+        /*--- Add the edge to the pack, which is computed once it is full ---*/
+        
+        if (batched) {
+          iLane = Batch->AddEdge(iEdge, iPoint, jPoint, geometry->GetEdge_Normal(iEdge),
+                                 node_storage.GetPrimitive(iPoint), node_storage.GetPrimitive(jPoint));
+          Batch->SetNeighbor(iLane, geometry->node[iPoint]->GetnNeighbor(), geometry->node[jPoint]->GetnNeighbor());
+          Batch->SetLambda(iLane, node[iPoint]->GetLambda(), node[jPoint]->GetLambda());
+          Batch->SetUndivided_Laplacian(iLane, node[iPoint]->GetUndivided_Laplacian(), node[jPoint]->GetUndivided_Laplacian());
+          Batch->SetSensor(iLane, node[iPoint]->GetSensor(), node[jPoint]->GetSensor());
+          if (Batch->GetnEdge() == BATCH_SIZE)
+            Batch_Residual(edge_numerics, Batch, Res, implicit, false, config);
+          continue;
+        }
+        
+        edge_numerics->SetNormal(geometry->GetEdge_Normal(iEdge));
+        edge_numerics->SetNeighbor(geometry->node[iPoint]->GetnNeighbor(), geometry->node[jPoint]->GetnNeighbor());
     
-    if (grid_movement) {
-      numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
-    }
+        /*--- Set primitive variables w/o reconstruction ---*/
     
-    /*--- Compute residuals, and Jacobians ---*/
+        edge_numerics->SetPrimitive(node_storage.GetPrimitive(iPoint), node_storage.GetPrimitive(jPoint));
     
-    numerics->ComputeResidual(Res_Conv, Jacobian_i, Jacobian_j, config);
+        /*--- Set the largest convective eigenvalue ---*/
     
-    /*--- Update convective and artificial dissipation residuals ---*/
+        edge_numerics->SetLambda(node[iPoint]->GetLambda(), node[jPoint]->GetLambda());
     
-    LinSysRes.AddBlock(iPoint, Res_Conv);
-    LinSysRes.SubtractBlock(jPoint, Res_Conv);
+        /*--- Set undivided laplacian an pressure based sensor ---*/
     
-    /*--- Set implicit computation ---*/
-    if (implicit) {
-      Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
-      Jacobian.AddBlock(iPoint, jPoint, Jacobian_j);
-      Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_i);
-      Jacobian.SubtractBlock(jPoint, jPoint, Jacobian_j);
+        if (jst_scheme) {
+          edge_numerics->SetUndivided_Laplacian(node[iPoint]->GetUndivided_Laplacian(), node[jPoint]->GetUndivided_Laplacian());
+          edge_numerics->SetSensor(node[iPoint]->GetSensor(), node[jPoint]->GetSensor());
+        }
+    
+        /*--- Grid movement ---*/
+    
+        if (grid_movement) {
+          edge_numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
+        }
+    
+        /*--- Compute residuals, and Jacobians ---*/
+    
+        edge_numerics->ComputeResidual(Res, Jac_i, Jac_j, config);
+    
+        /*--- Update convective and artificial dissipation residuals ---*/
+    
+        LinSysRes.AddBlock(iPoint, Res);
+        LinSysRes.SubtractBlock(jPoint, Res);
+    
+        /*--- Set implicit computation ---*/
+        if (implicit) {
+          Jacobian.UpdateBlocks(iEdge, Jac_i, Jac_j);
+        }
+      }
+      
+      /*--- Last (partial) pack of the color, all the threads must be done
+       with it before the points are updated by the next color ---*/
+      
+      if (batched) {
+        if (Batch->GetnEdge() > 0)
+          Batch_Residual(edge_numerics, Batch, Res, implicit, false, config);
+        SU2_OMP(barrier)
+      }
+      
+    }
+    
+    if (iThread > 0) {
+      for (iVar = 0; iVar < nVar; iVar++) {
+        delete [] Jac_i[iVar]; delete [] Jac_j[iVar];
+      }
+      delete [] Jac_i; delete [] Jac_j;
+      delete [] Res;
     }
+    
+    if (Batch != NULL) delete Batch;
+    
   }
   
 }
@@ -4656,15 +3835,7 @@ void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_conta
 void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                                    CConfig *config, unsigned short iMesh) {
   
-  su2double **Gradient_i, **Gradient_j, Project_Grad_i, Project_Grad_j, RoeVelocity[3] = {0.0,0.0,0.0}, R, sq_vel, RoeEnthalpy,
-  *V_i, *V_j, *S_i, *S_j, *Limiter_i = NULL, *Limiter_j = NULL, sqvel, Non_Physical = 1.0, Sensor_i, Sensor_j, Dissipation_i, Dissipation_j, *Coord_i, *Coord_j;
-  
-  su2double z, velocity2_i, velocity2_j, mach_i, mach_j, vel_i_corr[3], vel_j_corr[3];
-  
-  unsigned long iEdge, iPoint, jPoint, counter_local = 0, counter_global = 0;
-  unsigned short iDim, iVar;
-  
-  bool neg_density_i = false, neg_density_j = false, neg_pressure_i = false, neg_pressure_j = false, neg_sound_speed = false;
+  unsigned long counter_local = 0, counter_global = 0;
   
   unsigned long ExtIter = config->GetExtIter();
   bool implicit         = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
@@ -4677,221 +3848,311 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   bool van_albada       = config->GetKind_SlopeLimit_Flow() == VAN_ALBADA_EDGE;
   bool low_mach_corr    = config->Low_Mach_Correction();
   unsigned short kind_dissipation = config->GetKind_RoeLowDiss();
-    
-  /*--- Loop over all the edges ---*/
+  
+  /*--- The fluxes are computed in packs of edges when the scheme supports it ---*/
+  
+  bool batched = (config->GetBatched_Conv_Flow() && numerics->GetBatched() && !roe_turkel &&
+                  (kind_dissipation == NO_ROELOWDISS) && !config->GetAD_Mode());
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  /*--- Edges of the same color do not share points, hence they are processed
+   concurrently when several threads are available. The thermodynamically consistent
+   extrapolation and the low-Mach correction use the fluid model of the solver,
+   therefore the loop remains serial when they are active. ---*/
+
+  unsigned short nEdgeColor = geometry->GetnEdgeColor();
+  unsigned long *EdgeColor_Ptr = geometry->GetEdgeColor_Ptr(), *EdgeColor_Edge = geometry->GetEdgeColor_Edge();
+  bool threaded = (nEdgeColor > 1) && ideal_gas && !low_mach_corr;
+  
+  SU2_OMP(parallel if(threaded) reduction(+:counter_local))
+  {
+    
+    unsigned short iDim, iVar, iColor, iThread = OMP::GetThreadNum();
+    unsigned long iColorEdge, iEdge, iPoint, jPoint, *Nodes;
+    
+    su2double *Gradient_i, *Gradient_j, Project_Grad_i, Project_Grad_j, RoeVelocity[3] = {0.0,0.0,0.0}, R, sq_vel, RoeEnthalpy,
+    *V_i, *V_j, *S_i, *S_j, *Limiter_i = NULL, *Limiter_j = NULL, sqvel, Non_Physical = 1.0, Sensor_i, Sensor_j, Dissipation_i, Dissipation_j, *Coord_i, *Coord_j;
     
-    /*--- Points in edge and normal vectors ---*/
+    su2double z, velocity2_i, velocity2_j, mach_i, mach_j, vel_i_corr[3], vel_j_corr[3];
     
-    iPoint = geometry->edge[iEdge]->GetNode(0); jPoint = geometry->edge[iEdge]->GetNode(1);
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+    bool neg_density_i = false, neg_density_j = false, neg_pressure_i = false, neg_pressure_j = false, neg_sound_speed = false;
     
-    /*--- Roe Turkel preconditioning ---*/
+    /*--- Each thread uses its own numerics and auxiliary vectors (the first
+     thread uses the ones of the solver) ---*/
     
-    if (roe_turkel) {
-      sqvel = 0.0;
-      for (iDim = 0; iDim < nDim; iDim ++)
-        sqvel += config->GetVelocity_FreeStream()[iDim]*config->GetVelocity_FreeStream()[iDim];
-      numerics->SetVelocity2_Inf(sqvel);
+    CNumerics *edge_numerics = numerics->GetThread_Numerics(iThread);
+    
+    CNumericsBatch *Batch = NULL;
+    if (batched) Batch = new CNumericsBatch(nDim, nVar, false);
+    
+    su2double *Vec_i = Vector_i, *Vec_j = Vector_j, *Prim_i = Primitive_i, *Prim_j = Primitive_j,
+    *Sec_i = Secondary_i, *Sec_j = Secondary_j, *Res = Res_Conv, **Jac_i = Jacobian_i, **Jac_j = Jacobian_j;
+    
+    if (iThread > 0) {
+      Vec_i  = new su2double[nDim];          Vec_j  = new su2double[nDim];
+      Prim_i = new su2double[nPrimVar];      Prim_j = new su2double[nPrimVar];
+      Sec_i  = new su2double[nSecondaryVar]; Sec_j  = new su2double[nSecondaryVar];
+      Res    = new su2double[nVar];
+      Jac_i  = new su2double*[nVar];         Jac_j  = new su2double*[nVar];
+      for (iVar = 0; iVar < nVar; iVar++) {
+        Jac_i[iVar] = new su2double[nVar];   Jac_j[iVar] = new su2double[nVar];
+      }
     }
     
-    /*--- Grid movement ---*/
+    /*--- Loop over all the edges, color by color ---*/
+    
+    for (iColor = 0; iColor < nEdgeColor; iColor++) {
+      
+      SU2_OMP(for schedule(static))
+      for (iColorEdge = EdgeColor_Ptr[iColor]; iColorEdge < EdgeColor_Ptr[iColor+1]; iColorEdge++) {
+        
+        iEdge = EdgeColor_Edge[iColorEdge];
+        
+        /*--- Points in edge and normal vectors ---*/
+    
+        Nodes = geometry->GetEdge_Nodes(iEdge);
+        iPoint = Nodes[0]; jPoint = Nodes[1];
+        edge_numerics->SetNormal(geometry->GetEdge_Normal(iEdge));
+    
+        /*--- Roe Turkel preconditioning ---*/
+    
+        if (roe_turkel) {
+          sqvel = 0.0;
+          for (iDim = 0; iDim < nDim; iDim ++)
+            sqvel += config->GetVelocity_FreeStream()[iDim]*config->GetVelocity_FreeStream()[iDim];
+          edge_numerics->SetVelocity2_Inf(sqvel);
+        }
+    
+        /*--- Grid movement ---*/
     
-    if (grid_movement)
-      numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
+        if (grid_movement)
+          edge_numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
     
-    /*--- Get primitive variables ---*/
+        /*--- Get primitive variables from the contiguous storage ---*/
     
-    V_i = node[iPoint]->GetPrimitive(); V_j = node[jPoint]->GetPrimitive();
-    S_i = node[iPoint]->GetSecondary(); S_j = node[jPoint]->GetSecondary();
+        V_i = node_storage.GetPrimitive(iPoint); V_j = node_storage.GetPrimitive(jPoint);
+        S_i = node_storage.GetSecondary(iPoint); S_j = node_storage.GetSecondary(jPoint);
 
-    /*--- High order reconstruction using MUSCL strategy ---*/
+        /*--- High order reconstruction using MUSCL strategy ---*/
     
-    if (muscl) {
+        if (muscl) {
       
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Vector_i[iDim] = 0.5*(geometry->node[jPoint]->GetCoord(iDim) - geometry->node[iPoint]->GetCoord(iDim));
-        Vector_j[iDim] = 0.5*(geometry->node[iPoint]->GetCoord(iDim) - geometry->node[jPoint]->GetCoord(iDim));
-      }
+          Coord_i = geometry->GetPoint_Coord(iPoint);
+          Coord_j = geometry->GetPoint_Coord(jPoint);
+          for (iDim = 0; iDim < nDim; iDim++) {
+            Vec_i[iDim] = 0.5*(Coord_j[iDim] - Coord_i[iDim]);
+            Vec_j[iDim] = 0.5*(Coord_i[iDim] - Coord_j[iDim]);
+          }
       
-      Gradient_i = node[iPoint]->GetGradient_Primitive();
-      Gradient_j = node[jPoint]->GetGradient_Primitive();
-      if (limiter) {
-        Limiter_i = node[iPoint]->GetLimiter_Primitive();
-        Limiter_j = node[jPoint]->GetLimiter_Primitive();
-      }
+          Gradient_i = node_storage.GetGradient_Primitive(iPoint);
+          Gradient_j = node_storage.GetGradient_Primitive(jPoint);
+          if (limiter) {
+            Limiter_i = node_storage.GetLimiter_Primitive(iPoint);
+            Limiter_j = node_storage.GetLimiter_Primitive(jPoint);
+          }
       
-      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-        Project_Grad_i = 0.0; Project_Grad_j = 0.0;
-        Non_Physical = node[iPoint]->GetNon_Physical()*node[jPoint]->GetNon_Physical();
-        for (iDim = 0; iDim < nDim; iDim++) {
-          Project_Grad_i += Vector_i[iDim]*Gradient_i[iVar][iDim]*Non_Physical;
-          Project_Grad_j += Vector_j[iDim]*Gradient_j[iVar][iDim]*Non_Physical;
-        }
-        if (limiter) {
-          if (van_albada){
-            Limiter_i[iVar] = (V_j[iVar]-V_i[iVar])*(2.0*Project_Grad_i + V_j[iVar]-V_i[iVar])/(4*Project_Grad_i*Project_Grad_i+(V_j[iVar]-V_i[iVar])*(V_j[iVar]-V_i[iVar])+EPS);
-            Limiter_j[iVar] = (V_j[iVar]-V_i[iVar])*(-2.0*Project_Grad_j + V_j[iVar]-V_i[iVar])/(4*Project_Grad_j*Project_Grad_j+(V_j[iVar]-V_i[iVar])*(V_j[iVar]-V_i[iVar])+EPS);
+          Non_Physical = node[iPoint]->GetNon_Physical()*node[jPoint]->GetNon_Physical();
+      
+          for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+            Project_Grad_i = 0.0; Project_Grad_j = 0.0;
+            for (iDim = 0; iDim < nDim; iDim++) {
+              Project_Grad_i += Vec_i[iDim]*Gradient_i[iVar*nDim+iDim]*Non_Physical;
+              Project_Grad_j += Vec_j[iDim]*Gradient_j[iVar*nDim+iDim]*Non_Physical;
+            }
+            if (limiter) {
+              if (van_albada){
+                Limiter_i[iVar] = (V_j[iVar]-V_i[iVar])*(2.0*Project_Grad_i + V_j[iVar]-V_i[iVar])/(4*Project_Grad_i*Project_Grad_i+(V_j[iVar]-V_i[iVar])*(V_j[iVar]-V_i[iVar])+EPS);
+                Limiter_j[iVar] = (V_j[iVar]-V_i[iVar])*(-2.0*Project_Grad_j + V_j[iVar]-V_i[iVar])/(4*Project_Grad_j*Project_Grad_j+(V_j[iVar]-V_i[iVar])*(V_j[iVar]-V_i[iVar])+EPS);
+              }
+              Prim_i[iVar] = V_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
+              Prim_j[iVar] = V_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
+            }
+            else {
+              Prim_i[iVar] = V_i[iVar] + Project_Grad_i;
+              Prim_j[iVar] = V_j[iVar] + Project_Grad_j;
+            }
           }
-          Primitive_i[iVar] = V_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
-          Primitive_j[iVar] = V_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
-        }
-        else {
-          Primitive_i[iVar] = V_i[iVar] + Project_Grad_i;
-          Primitive_j[iVar] = V_j[iVar] + Project_Grad_j;
-        }
-      }
 
-      /*--- Recompute the extrapolated quantities in a
-       thermodynamic consistent way  ---*/
+          /*--- Recompute the extrapolated quantities in a
+           thermodynamic consistent way  ---*/
 
-      if (!ideal_gas || low_mach_corr) { ComputeConsExtrapolation(config); }
+          if (!ideal_gas || low_mach_corr) { ComputeConsExtrapolation(config); }
 
-      /*--- Low-Mach number correction ---*/
+          /*--- Low-Mach number correction ---*/
 
-      if (low_mach_corr) {
+          if (low_mach_corr) {
 
-        velocity2_i = 0.0;
-        velocity2_j = 0.0;
+            velocity2_i = 0.0;
+            velocity2_j = 0.0;
         
-        for (iDim = 0; iDim < nDim; iDim++) {
-          velocity2_i += Primitive_i[iDim+1]*Primitive_i[iDim+1];
-          velocity2_j += Primitive_j[iDim+1]*Primitive_j[iDim+1];
-        }
-        mach_i = sqrt(velocity2_i)/Primitive_i[nDim+4];
-        mach_j = sqrt(velocity2_j)/Primitive_j[nDim+4];
+            for (iDim = 0; iDim < nDim; iDim++) {
+              velocity2_i += Prim_i[iDim+1]*Prim_i[iDim+1];
+              velocity2_j += Prim_j[iDim+1]*Prim_j[iDim+1];
+            }
+            mach_i = sqrt(velocity2_i)/Prim_i[nDim+4];
+            mach_j = sqrt(velocity2_j)/Prim_j[nDim+4];
 
-        z = min(max(mach_i,mach_j),1.0);
-        velocity2_i = 0.0;
-        velocity2_j = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++) {
-          vel_i_corr[iDim] = ( Primitive_i[iDim+1] + Primitive_j[iDim+1] )/2.0 \
-                  + z * ( Primitive_i[iDim+1] - Primitive_j[iDim+1] )/2.0;
-          vel_j_corr[iDim] = ( Primitive_i[iDim+1] + Primitive_j[iDim+1] )/2.0 \
-                  + z * ( Primitive_j[iDim+1] - Primitive_i[iDim+1] )/2.0;
+            z = min(max(mach_i,mach_j),1.0);
+            velocity2_i = 0.0;
+            velocity2_j = 0.0;
+            for (iDim = 0; iDim < nDim; iDim++) {
+              vel_i_corr[iDim] = ( Prim_i[iDim+1] + Prim_j[iDim+1] )/2.0 \
+                      + z * ( Prim_i[iDim+1] - Prim_j[iDim+1] )/2.0;
+              vel_j_corr[iDim] = ( Prim_i[iDim+1] + Prim_j[iDim+1] )/2.0 \
+                      + z * ( Prim_j[iDim+1] - Prim_i[iDim+1] )/2.0;
 
-          velocity2_j += vel_j_corr[iDim]*vel_j_corr[iDim];
-          velocity2_i += vel_i_corr[iDim]*vel_i_corr[iDim];
+              velocity2_j += vel_j_corr[iDim]*vel_j_corr[iDim];
+              velocity2_i += vel_i_corr[iDim]*vel_i_corr[iDim];
 
-          Primitive_i[iDim+1] = vel_i_corr[iDim];
-          Primitive_j[iDim+1] = vel_j_corr[iDim];
-        }
+              Prim_i[iDim+1] = vel_i_corr[iDim];
+              Prim_j[iDim+1] = vel_j_corr[iDim];
+            }
 
-        FluidModel->SetEnergy_Prho(Primitive_i[nDim+1],Primitive_i[nDim+2]);
-        Primitive_i[nDim+3]= FluidModel->GetStaticEnergy() + Primitive_i[nDim+1]/Primitive_i[nDim+2] + 0.5*velocity2_i;
+            FluidModel->SetEnergy_Prho(Prim_i[nDim+1],Prim_i[nDim+2]);
+            Prim_i[nDim+3]= FluidModel->GetStaticEnergy() + Prim_i[nDim+1]/Prim_i[nDim+2] + 0.5*velocity2_i;
         
-        FluidModel->SetEnergy_Prho(Primitive_j[nDim+1],Primitive_j[nDim+2]);
-        Primitive_j[nDim+3]= FluidModel->GetStaticEnergy() + Primitive_j[nDim+1]/Primitive_j[nDim+2] + 0.5*velocity2_j;
+            FluidModel->SetEnergy_Prho(Prim_j[nDim+1],Prim_j[nDim+2]);
+            Prim_j[nDim+3]= FluidModel->GetStaticEnergy() + Prim_j[nDim+1]/Prim_j[nDim+2] + 0.5*velocity2_j;
         
-      }
+          }
       
-      /*--- Check for non-physical solutions after reconstruction. If found,
-       use the cell-average value of the solution. This results in a locally
-       first-order approximation, but this is typically only active
-       during the start-up of a calculation. If non-physical, use the 
-       cell-averaged state. ---*/
+          /*--- Check for non-physical solutions after reconstruction. If found,
+           use the cell-average value of the solution. This results in a locally
+           first-order approximation, but this is typically only active
+           during the start-up of a calculation. If non-physical, use the 
+           cell-averaged state. ---*/
       
-      neg_pressure_i = (Primitive_i[nDim+1] < 0.0); neg_pressure_j = (Primitive_j[nDim+1] < 0.0);
-      neg_density_i  = (Primitive_i[nDim+2] < 0.0); neg_density_j  = (Primitive_j[nDim+2] < 0.0);
+          neg_pressure_i = (Prim_i[nDim+1] < 0.0); neg_pressure_j = (Prim_j[nDim+1] < 0.0);
+          neg_density_i  = (Prim_i[nDim+2] < 0.0); neg_density_j  = (Prim_j[nDim+2] < 0.0);
 
-      R = sqrt(fabs(Primitive_j[nDim+2]/Primitive_i[nDim+2]));
-      sq_vel = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++) {
-        RoeVelocity[iDim] = (R*Primitive_j[iDim+1]+Primitive_i[iDim+1])/(R+1);
-        sq_vel += RoeVelocity[iDim]*RoeVelocity[iDim];
-      }
-      RoeEnthalpy = (R*Primitive_j[nDim+3]+Primitive_i[nDim+3])/(R+1);
-      neg_sound_speed = ((Gamma-1)*(RoeEnthalpy-0.5*sq_vel) < 0.0);
-      
-      if (neg_sound_speed) {
-        for (iVar = 0; iVar < nPrimVar; iVar++) {
-          Primitive_i[iVar] = V_i[iVar];
-          Primitive_j[iVar] = V_j[iVar]; }
-        Secondary_i[0] = S_i[0]; Secondary_i[1] = S_i[1];
-        Secondary_j[0] = S_i[0]; Secondary_j[1] = S_i[1];
-        counter_local++;
-      }
+          R = sqrt(fabs(Prim_j[nDim+2]/Prim_i[nDim+2]));
+          sq_vel = 0.0;
+          for (iDim = 0; iDim < nDim; iDim++) {
+            RoeVelocity[iDim] = (R*Prim_j[iDim+1]+Prim_i[iDim+1])/(R+1);
+            sq_vel += RoeVelocity[iDim]*RoeVelocity[iDim];
+          }
+          RoeEnthalpy = (R*Prim_j[nDim+3]+Prim_i[nDim+3])/(R+1);
+          neg_sound_speed = ((Gamma-1)*(RoeEnthalpy-0.5*sq_vel) < 0.0);
       
-      if (neg_density_i || neg_pressure_i) {
-        for (iVar = 0; iVar < nPrimVar; iVar++) Primitive_i[iVar] = V_i[iVar];
-        Secondary_i[0] = S_i[0]; Secondary_i[1] = S_i[1];
-        counter_local++;
-      }
+          if (neg_sound_speed) {
+            for (iVar = 0; iVar < nPrimVar; iVar++) {
+              Prim_i[iVar] = V_i[iVar];
+              Prim_j[iVar] = V_j[iVar]; }
+            Sec_i[0] = S_i[0]; Sec_i[1] = S_i[1];
+            Sec_j[0] = S_i[0]; Sec_j[1] = S_i[1];
+            counter_local++;
+          }
       
-      if (neg_density_j || neg_pressure_j) {
-        for (iVar = 0; iVar < nPrimVar; iVar++) Primitive_j[iVar] = V_j[iVar];
-        Secondary_j[0] = S_j[0]; Secondary_j[1] = S_j[1];
-        counter_local++;
-      }
+          if (neg_density_i || neg_pressure_i) {
+            for (iVar = 0; iVar < nPrimVar; iVar++) Prim_i[iVar] = V_i[iVar];
+            Sec_i[0] = S_i[0]; Sec_i[1] = S_i[1];
+            counter_local++;
+          }
+      
+          if (neg_density_j || neg_pressure_j) {
+            for (iVar = 0; iVar < nPrimVar; iVar++) Prim_j[iVar] = V_j[iVar];
+            Sec_j[0] = S_j[0]; Sec_j[1] = S_j[1];
+            counter_local++;
+          }
 
-      numerics->SetPrimitive(Primitive_i, Primitive_j);
-      numerics->SetSecondary(Secondary_i, Secondary_j);
+          edge_numerics->SetPrimitive(Prim_i, Prim_j);
+          edge_numerics->SetSecondary(Sec_i, Sec_j);
       
-    }
-    else {
+        }
+        else {
       
-      /*--- Set conservative variables without reconstruction ---*/
+          /*--- Set conservative variables without reconstruction ---*/
       
-      numerics->SetPrimitive(V_i, V_j);
-      numerics->SetSecondary(S_i, S_j);
+          edge_numerics->SetPrimitive(V_i, V_j);
+          edge_numerics->SetSecondary(S_i, S_j);
       
-    }
+        }
     
-    /*--- Roe Low Dissipation Scheme ---*/
+        /*--- Roe Low Dissipation Scheme ---*/
     
-    if (kind_dissipation != NO_ROELOWDISS){
+        if (kind_dissipation != NO_ROELOWDISS){
       
-      Dissipation_i = node[iPoint]->GetRoe_Dissipation();
-      Dissipation_j = node[jPoint]->GetRoe_Dissipation();
-      numerics->SetDissipation(Dissipation_i, Dissipation_j);
+          Dissipation_i = node[iPoint]->GetRoe_Dissipation();
+          Dissipation_j = node[jPoint]->GetRoe_Dissipation();
+          edge_numerics->SetDissipation(Dissipation_i, Dissipation_j);
             
-      if (kind_dissipation == FD_DUCROS || kind_dissipation == NTS_DUCROS){
-        Sensor_i = node[iPoint]->GetSensor();
-        Sensor_j = node[jPoint]->GetSensor();
-        numerics->SetSensor(Sensor_i, Sensor_j);
-      }
-      if (kind_dissipation == NTS || kind_dissipation == NTS_DUCROS){
-        Coord_i = geometry->node[iPoint]->GetCoord();
-        Coord_j = geometry->node[jPoint]->GetCoord();
-        numerics->SetCoord(Coord_i, Coord_j);
-      }
-    }
+          if (kind_dissipation == FD_DUCROS || kind_dissipation == NTS_DUCROS){
+            Sensor_i = node[iPoint]->GetSensor();
+            Sensor_j = node[jPoint]->GetSensor();
+            edge_numerics->SetSensor(Sensor_i, Sensor_j);
+          }
+          if (kind_dissipation == NTS || kind_dissipation == NTS_DUCROS){
+            Coord_i = geometry->GetPoint_Coord(iPoint);
+            Coord_j = geometry->GetPoint_Coord(jPoint);
+            edge_numerics->SetCoord(Coord_i, Coord_j);
+          }
+        }
       
-    /*--- Compute the residual ---*/
+        /*--- Add the edge to the pack, which is computed once it is full ---*/
+        
+        if (batched) {
+          Batch->AddEdge(iEdge, iPoint, jPoint, geometry->GetEdge_Normal(iEdge),
+                         (muscl? Prim_i : V_i), (muscl? Prim_j : V_j));
+          if (Batch->GetnEdge() == BATCH_SIZE)
+            Batch_Residual(edge_numerics, Batch, Res, implicit, false, config);
+          continue;
+        }
+        
+        /*--- Compute the residual ---*/
     
-    numerics->ComputeResidual(Res_Conv, Jacobian_i, Jacobian_j, config);
+        edge_numerics->ComputeResidual(Res, Jac_i, Jac_j, config);
 
-    /*--- Update residual value ---*/
+        /*--- Update residual value ---*/
     
-    LinSysRes.AddBlock(iPoint, Res_Conv);
-    LinSysRes.SubtractBlock(jPoint, Res_Conv);
+        LinSysRes.AddBlock(iPoint, Res);
+        LinSysRes.SubtractBlock(jPoint, Res);
     
-    /*--- Set implicit Jacobians ---*/
+        /*--- Set implicit Jacobians ---*/
     
-    if (implicit) {
-      Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
-      Jacobian.AddBlock(iPoint, jPoint, Jacobian_j);
-      Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_i);
-      Jacobian.SubtractBlock(jPoint, jPoint, Jacobian_j);
-    }
+        if (implicit) {
+          Jacobian.UpdateBlocks(iEdge, Jac_i, Jac_j);
+        }
+    
+        /*--- Roe Turkel preconditioning, set the value of beta ---*/
     
-    /*--- Roe Turkel preconditioning, set the value of beta ---*/
+        if (roe_turkel) {
+          node[iPoint]->SetPreconditioner_Beta(edge_numerics->GetPrecond_Beta());
+          node[jPoint]->SetPreconditioner_Beta(edge_numerics->GetPrecond_Beta());
+        }
     
-    if (roe_turkel) {
-      node[iPoint]->SetPreconditioner_Beta(numerics->GetPrecond_Beta());
-      node[jPoint]->SetPreconditioner_Beta(numerics->GetPrecond_Beta());
-    }
+        /*--- Set the final value of the Roe dissipation coefficient ---*/
     
-    /*--- Set the final value of the Roe dissipation coefficient ---*/
+        if (kind_dissipation != NO_ROELOWDISS){
+          node[iPoint]->SetRoe_Dissipation(edge_numerics->GetDissipation());
+          node[jPoint]->SetRoe_Dissipation(edge_numerics->GetDissipation());      
+        }
+      }
+      
+      /*--- Last (partial) pack of the color, all the threads must be done
+       with it before the points are updated by the next color ---*/
+      
+      if (batched) {
+        if (Batch->GetnEdge() > 0)
+          Batch_Residual(edge_numerics, Batch, Res, implicit, false, config);
+        SU2_OMP(barrier)
+      }
+      
+    }
     
-    if (kind_dissipation != NO_ROELOWDISS){
-      node[iPoint]->SetRoe_Dissipation(numerics->GetDissipation());
-      node[jPoint]->SetRoe_Dissipation(numerics->GetDissipation());      
+    if (iThread > 0) {
+      for (iVar = 0; iVar < nVar; iVar++) {
+        delete [] Jac_i[iVar]; delete [] Jac_j[iVar];
+      }
+      delete [] Jac_i;  delete [] Jac_j;
+      delete [] Vec_i;  delete [] Vec_j;
+      delete [] Prim_i; delete [] Prim_j;
+      delete [] Sec_i;  delete [] Sec_j;
+      delete [] Res;
     }
     
+    if (Batch != NULL) delete Batch;
+    
   }
-
+  
   /*--- Warning message about non-physical reconstructions ---*/
   
   if (config->GetConsole_Output_Verb() == VERB_HIGH) {
@@ -4904,6 +4165,43 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   }
 }
 
+void CEulerSolver::Batch_Residual(CNumerics *numerics, CNumericsBatch *batch, su2double *val_residual,
+                                  bool implicit, bool viscous, CConfig *config) {
+  
+  unsigned short iLane;
+  unsigned short nEdge_Batch = batch->GetnEdge();
+  
+  /*--- Compute all the lanes of the pack (the unused ones repeat the first edge) ---*/
+  
+  batch->Fill();
+  numerics->ComputeResidual_Batch(batch, config);
+  
+  /*--- Update the residual and the Jacobian in the order in which the
+   edges were added, as done for a single edge. The Jacobians are read
+   directly from the pack, the entries of a lane are BATCH_SIZE apart ---*/
+  
+  for (iLane = 0; iLane < nEdge_Batch; iLane++) {
+    
+    batch->GetResidual(iLane, val_residual);
+    
+    if (!viscous) {
+      LinSysRes.AddBlock(batch->GetPoint_i(iLane), val_residual);
+      LinSysRes.SubtractBlock(batch->GetPoint_j(iLane), val_residual);
+      if (implicit)
+        Jacobian.UpdateBlocks(batch->GetEdge(iLane), &batch->Jacobian_i[iLane], &batch->Jacobian_j[iLane], BATCH_SIZE);
+    }
+    else {
+      LinSysRes.SubtractBlock(batch->GetPoint_i(iLane), val_residual);
+      LinSysRes.AddBlock(batch->GetPoint_j(iLane), val_residual);
+      if (implicit)
+        Jacobian.UpdateBlocks_Sub(batch->GetEdge(iLane), &batch->Jacobian_i[iLane], &batch->Jacobian_j[iLane], BATCH_SIZE);
+    }
+  }
+  
+  batch->Clear();
+  
+}
+
 void CEulerSolver::ComputeConsExtrapolation(CConfig *config) {
   
   unsigned short iDim;
@@ -5214,9 +4512,8 @@ void CEulerSolver::SetMax_Eigenvalue(CGeometry *geometry, CConfig *config) {
     }
   }
   
-  /*--- MPI parallelization ---*/
-  
-  Set_MPI_MaxEigenvalue(geometry, config);
+  /*--- The halo values are exchanged by the caller, together with the
+   other quantities of the artificial dissipation. ---*/
   
 }
 
@@ -5270,9 +4567,8 @@ void CEulerSolver::SetUndivided_Laplacian(CGeometry *geometry, CConfig *config)
     
   }
   
-  /*--- MPI parallelization ---*/
-  
-  Set_MPI_Undivided_Laplacian(geometry, config);
+  /*--- The halo values are exchanged by the caller, together with the
+   other quantities of the artificial dissipation. ---*/
   
   delete [] Diff;
   
@@ -5328,9 +4624,8 @@ void CEulerSolver::SetCentered_Dissipation_Sensor(CGeometry *geometry, CConfig *
   for (iPoint = 0; iPoint < nPointDomain; iPoint++)
     node[iPoint]->SetSensor(fabs(iPoint_UndLapl[iPoint]) / jPoint_UndLapl[iPoint]);
   
-  /*--- MPI parallelization ---*/
-  
-  Set_MPI_Sensor(geometry, config);
+  /*--- The halo values are exchanged by the caller, together with the
+   other quantities of the artificial dissipation. ---*/
   
 }
 
@@ -5418,10 +4713,6 @@ void CEulerSolver::Pressure_Forces(CGeometry *geometry, CConfig *config) {
   su2double MomentX_Force[3] = {0.0,0.0,0.0}, MomentY_Force[3] = {0.0,0.0,0.0}, MomentZ_Force[3] = {0.0,0.0,0.0};
   su2double AxiFactor;
 
-#ifdef HAVE_MPI
-  su2double MyAllBound_CD_Inv, MyAllBound_CL_Inv, MyAllBound_CSF_Inv, MyAllBound_CMx_Inv, MyAllBound_CMy_Inv, MyAllBound_CMz_Inv, MyAllBound_CoPx_Inv, MyAllBound_CoPy_Inv, MyAllBound_CoPz_Inv, MyAllBound_CFx_Inv, MyAllBound_CFy_Inv, MyAllBound_CFz_Inv, MyAllBound_CT_Inv, MyAllBound_CQ_Inv, MyAllBound_CNearFieldOF_Inv, *MySurface_CL_Inv = NULL, *MySurface_CD_Inv = NULL, *MySurface_CSF_Inv = NULL, *MySurface_CEff_Inv = NULL, *MySurface_CFx_Inv = NULL, *MySurface_CFy_Inv = NULL, *MySurface_CFz_Inv = NULL, *MySurface_CMx_Inv = NULL, *MySurface_CMy_Inv = NULL, *MySurface_CMz_Inv = NULL;
-#endif
-  
   su2double Alpha           = config->GetAoA()*PI_NUMBER/180.0;
   su2double Beta            = config->GetAoS()*PI_NUMBER/180.0;
   su2double RefArea    = config->GetRefArea();
@@ -5672,97 +4963,40 @@ void CEulerSolver::Pressure_Forces(CGeometry *geometry, CConfig *config) {
   
 #ifdef HAVE_MPI
   
-  /*--- Add AllBound information using all the nodes ---*/
-  
-  MyAllBound_CD_Inv        = AllBound_CD_Inv;        AllBound_CD_Inv = 0.0;
-  MyAllBound_CL_Inv        = AllBound_CL_Inv;        AllBound_CL_Inv = 0.0;
-  MyAllBound_CSF_Inv   = AllBound_CSF_Inv;   AllBound_CSF_Inv = 0.0;
-  AllBound_CEff_Inv = 0.0;
-  MyAllBound_CMx_Inv          = AllBound_CMx_Inv;          AllBound_CMx_Inv = 0.0;
-  MyAllBound_CMy_Inv          = AllBound_CMy_Inv;          AllBound_CMy_Inv = 0.0;
-  MyAllBound_CMz_Inv          = AllBound_CMz_Inv;          AllBound_CMz_Inv = 0.0;
-  MyAllBound_CoPx_Inv          = AllBound_CoPx_Inv;          AllBound_CoPx_Inv = 0.0;
-  MyAllBound_CoPy_Inv          = AllBound_CoPy_Inv;          AllBound_CoPy_Inv = 0.0;
-  MyAllBound_CoPz_Inv          = AllBound_CoPz_Inv;          AllBound_CoPz_Inv = 0.0;
-  MyAllBound_CFx_Inv          = AllBound_CFx_Inv;          AllBound_CFx_Inv = 0.0;
-  MyAllBound_CFy_Inv          = AllBound_CFy_Inv;          AllBound_CFy_Inv = 0.0;
-  MyAllBound_CFz_Inv          = AllBound_CFz_Inv;          AllBound_CFz_Inv = 0.0;
-  MyAllBound_CT_Inv           = AllBound_CT_Inv;           AllBound_CT_Inv = 0.0;
-  MyAllBound_CQ_Inv           = AllBound_CQ_Inv;           AllBound_CQ_Inv = 0.0;
-  AllBound_CMerit_Inv = 0.0;
-  MyAllBound_CNearFieldOF_Inv = AllBound_CNearFieldOF_Inv; AllBound_CNearFieldOF_Inv = 0.0;
-  
-  SU2_MPI::Allreduce(&MyAllBound_CD_Inv, &AllBound_CD_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CL_Inv, &AllBound_CL_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CSF_Inv, &AllBound_CSF_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  /*--- Add AllBound information and the forces on the surfaces using all
+   the nodes, with a single reduction for all the coefficients ---*/
+  
+  CSumReduction Coefficients;
+  Coefficients.Add(&AllBound_CD_Inv);
+  Coefficients.Add(&AllBound_CL_Inv);
+  Coefficients.Add(&AllBound_CSF_Inv);
+  Coefficients.Add(&AllBound_CMx_Inv);
+  Coefficients.Add(&AllBound_CMy_Inv);
+  Coefficients.Add(&AllBound_CMz_Inv);
+  Coefficients.Add(&AllBound_CoPx_Inv);
+  Coefficients.Add(&AllBound_CoPy_Inv);
+  Coefficients.Add(&AllBound_CoPz_Inv);
+  Coefficients.Add(&AllBound_CFx_Inv);
+  Coefficients.Add(&AllBound_CFy_Inv);
+  Coefficients.Add(&AllBound_CFz_Inv);
+  Coefficients.Add(&AllBound_CT_Inv);
+  Coefficients.Add(&AllBound_CQ_Inv);
+  Coefficients.Add(&AllBound_CNearFieldOF_Inv);
+  Coefficients.Add(Surface_CL_Inv, config->GetnMarker_Monitoring());
+  Coefficients.Add(Surface_CD_Inv, config->GetnMarker_Monitoring());
+  Coefficients.Add(Surface_CSF_Inv, config->GetnMarker_Monitoring());
+  Coefficients.Add(Surface_CFx_Inv, config->GetnMarker_Monitoring());
+  Coefficients.Add(Surface_CFy_Inv, config->GetnMarker_Monitoring());
+  Coefficients.Add(Surface_CFz_Inv, config->GetnMarker_Monitoring());
+  Coefficients.Add(Surface_CMx_Inv, config->GetnMarker_Monitoring());
+  Coefficients.Add(Surface_CMy_Inv, config->GetnMarker_Monitoring());
+  Coefficients.Add(Surface_CMz_Inv, config->GetnMarker_Monitoring());
+  Coefficients.Reduce();
+  
   AllBound_CEff_Inv = AllBound_CL_Inv / (AllBound_CD_Inv + EPS);
-  SU2_MPI::Allreduce(&MyAllBound_CMx_Inv, &AllBound_CMx_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CMy_Inv, &AllBound_CMy_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CMz_Inv, &AllBound_CMz_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CoPx_Inv, &AllBound_CoPx_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CoPy_Inv, &AllBound_CoPy_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CoPz_Inv, &AllBound_CoPz_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CFx_Inv, &AllBound_CFx_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CFy_Inv, &AllBound_CFy_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CFz_Inv, &AllBound_CFz_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CT_Inv, &AllBound_CT_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CQ_Inv, &AllBound_CQ_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
   AllBound_CMerit_Inv = AllBound_CT_Inv / (AllBound_CQ_Inv + EPS);
-  SU2_MPI::Allreduce(&MyAllBound_CNearFieldOF_Inv, &AllBound_CNearFieldOF_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  
-  /*--- Add the forces on the surfaces using all the nodes ---*/
-  
-  MySurface_CL_Inv      = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CD_Inv      = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CSF_Inv = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CEff_Inv       = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFx_Inv        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFy_Inv        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFz_Inv        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMx_Inv        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMy_Inv        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMz_Inv        = new su2double[config->GetnMarker_Monitoring()];
-
-  for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
-    MySurface_CL_Inv[iMarker_Monitoring]      = Surface_CL_Inv[iMarker_Monitoring];
-    MySurface_CD_Inv[iMarker_Monitoring]      = Surface_CD_Inv[iMarker_Monitoring];
-    MySurface_CSF_Inv[iMarker_Monitoring] = Surface_CSF_Inv[iMarker_Monitoring];
-    MySurface_CEff_Inv[iMarker_Monitoring]       = Surface_CEff_Inv[iMarker_Monitoring];
-    MySurface_CFx_Inv[iMarker_Monitoring]        = Surface_CFx_Inv[iMarker_Monitoring];
-    MySurface_CFy_Inv[iMarker_Monitoring]        = Surface_CFy_Inv[iMarker_Monitoring];
-    MySurface_CFz_Inv[iMarker_Monitoring]        = Surface_CFz_Inv[iMarker_Monitoring];
-    MySurface_CMx_Inv[iMarker_Monitoring]        = Surface_CMx_Inv[iMarker_Monitoring];
-    MySurface_CMy_Inv[iMarker_Monitoring]        = Surface_CMy_Inv[iMarker_Monitoring];
-    MySurface_CMz_Inv[iMarker_Monitoring]        = Surface_CMz_Inv[iMarker_Monitoring];
-
-    Surface_CL_Inv[iMarker_Monitoring]         = 0.0;
-    Surface_CD_Inv[iMarker_Monitoring]         = 0.0;
-    Surface_CSF_Inv[iMarker_Monitoring]        = 0.0;
-    Surface_CEff_Inv[iMarker_Monitoring]       = 0.0;
-    Surface_CFx_Inv[iMarker_Monitoring]        = 0.0;
-    Surface_CFy_Inv[iMarker_Monitoring]        = 0.0;
-    Surface_CFz_Inv[iMarker_Monitoring]        = 0.0;
-    Surface_CMx_Inv[iMarker_Monitoring]        = 0.0;
-    Surface_CMy_Inv[iMarker_Monitoring]        = 0.0;
-    Surface_CMz_Inv[iMarker_Monitoring]        = 0.0;
-  }
-  
-  SU2_MPI::Allreduce(MySurface_CL_Inv, Surface_CL_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CD_Inv, Surface_CD_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CSF_Inv, Surface_CSF_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
   for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++)
     Surface_CEff_Inv[iMarker_Monitoring] = Surface_CL_Inv[iMarker_Monitoring] / (Surface_CD_Inv[iMarker_Monitoring] + EPS);
-  SU2_MPI::Allreduce(MySurface_CFx_Inv, Surface_CFx_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CFy_Inv, Surface_CFy_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CFz_Inv, Surface_CFz_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CMx_Inv, Surface_CMx_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CMy_Inv, Surface_CMy_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CMz_Inv, Surface_CMz_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  
-  delete [] MySurface_CL_Inv; delete [] MySurface_CD_Inv; delete [] MySurface_CSF_Inv;
-  delete [] MySurface_CEff_Inv;  delete [] MySurface_CFx_Inv;   delete [] MySurface_CFy_Inv;
-  delete [] MySurface_CFz_Inv;   delete [] MySurface_CMx_Inv;   delete [] MySurface_CMy_Inv;
-  delete [] MySurface_CMz_Inv;
   
 #endif
   
@@ -5814,18 +5048,6 @@ void CEulerSolver::Momentum_Forces(CGeometry *geometry, CConfig *config) {
   su2double MomentX_Force[3] = {0.0,0.0,0.0}, MomentY_Force[3] = {0.0,0.0,0.0}, MomentZ_Force[3] = {0.0,0.0,0.0};
   su2double AxiFactor;
   
-#ifdef HAVE_MPI
-  su2double MyAllBound_CD_Mnt, MyAllBound_CL_Mnt, MyAllBound_CSF_Mnt,
-  MyAllBound_CMx_Mnt, MyAllBound_CMy_Mnt, MyAllBound_CMz_Mnt,
-  MyAllBound_CoPx_Mnt, MyAllBound_CoPy_Mnt, MyAllBound_CoPz_Mnt,
-  MyAllBound_CFx_Mnt, MyAllBound_CFy_Mnt, MyAllBound_CFz_Mnt, MyAllBound_CT_Mnt,
-  MyAllBound_CQ_Mnt,
-  *MySurface_CL_Mnt = NULL, *MySurface_CD_Mnt = NULL, *MySurface_CSF_Mnt = NULL,
-  *MySurface_CEff_Mnt = NULL, *MySurface_CFx_Mnt = NULL, *MySurface_CFy_Mnt = NULL,
-  *MySurface_CFz_Mnt = NULL,
-  *MySurface_CMx_Mnt = NULL, *MySurface_CMy_Mnt = NULL,  *MySurface_CMz_Mnt = NULL;
-#endif
-  
   su2double Alpha            = config->GetAoA()*PI_NUMBER/180.0;
   su2double Beta             = config->GetAoS()*PI_NUMBER/180.0;
   su2double RefArea     = config->GetRefArea();
@@ -6049,93 +5271,39 @@ void CEulerSolver::Momentum_Forces(CGeometry *geometry, CConfig *config) {
   
 #ifdef HAVE_MPI
   
-  /*--- Add AllBound information using all the nodes ---*/
-  
-  MyAllBound_CD_Mnt           = AllBound_CD_Mnt;           AllBound_CD_Mnt = 0.0;
-  MyAllBound_CL_Mnt           = AllBound_CL_Mnt;           AllBound_CL_Mnt = 0.0;
-  MyAllBound_CSF_Mnt          = AllBound_CSF_Mnt;          AllBound_CSF_Mnt = 0.0;
-  MyAllBound_CFx_Mnt          = AllBound_CFx_Mnt;          AllBound_CFx_Mnt = 0.0;
-  MyAllBound_CFy_Mnt          = AllBound_CFy_Mnt;          AllBound_CFy_Mnt = 0.0;
-  MyAllBound_CFz_Mnt          = AllBound_CFz_Mnt;          AllBound_CFz_Mnt = 0.0;
-  MyAllBound_CMx_Mnt          = AllBound_CMx_Mnt;          AllBound_CMx_Mnt = 0.0;
-  MyAllBound_CMy_Mnt          = AllBound_CMy_Mnt;          AllBound_CMy_Mnt = 0.0;
-  MyAllBound_CMz_Mnt          = AllBound_CMz_Mnt;          AllBound_CMz_Mnt = 0.0;
-  MyAllBound_CoPx_Mnt         = AllBound_CoPx_Mnt;         AllBound_CoPx_Mnt = 0.0;
-  MyAllBound_CoPy_Mnt         = AllBound_CoPy_Mnt;         AllBound_CoPy_Mnt = 0.0;
-  MyAllBound_CoPz_Mnt         = AllBound_CoPz_Mnt;         AllBound_CoPz_Mnt = 0.0;
-  MyAllBound_CT_Mnt           = AllBound_CT_Mnt;           AllBound_CT_Mnt = 0.0;
-  MyAllBound_CQ_Mnt           = AllBound_CQ_Mnt;           AllBound_CQ_Mnt = 0.0;
-  
-  SU2_MPI::Allreduce(&MyAllBound_CD_Mnt, &AllBound_CD_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CL_Mnt, &AllBound_CL_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CSF_Mnt, &AllBound_CSF_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  /*--- Add AllBound information and the forces on the surfaces using all
+   the nodes, with a single reduction for all the coefficients ---*/
+  
+  CSumReduction Coefficients;
+  Coefficients.Add(&AllBound_CD_Mnt);
+  Coefficients.Add(&AllBound_CL_Mnt);
+  Coefficients.Add(&AllBound_CSF_Mnt);
+  Coefficients.Add(&AllBound_CFx_Mnt);
+  Coefficients.Add(&AllBound_CFy_Mnt);
+  Coefficients.Add(&AllBound_CFz_Mnt);
+  Coefficients.Add(&AllBound_CMx_Mnt);
+  Coefficients.Add(&AllBound_CMy_Mnt);
+  Coefficients.Add(&AllBound_CMz_Mnt);
+  Coefficients.Add(&AllBound_CoPx_Mnt);
+  Coefficients.Add(&AllBound_CoPy_Mnt);
+  Coefficients.Add(&AllBound_CoPz_Mnt);
+  Coefficients.Add(&AllBound_CT_Mnt);
+  Coefficients.Add(&AllBound_CQ_Mnt);
+  Coefficients.Add(Surface_CL_Mnt, config->GetnMarker_Monitoring());
+  Coefficients.Add(Surface_CD_Mnt, config->GetnMarker_Monitoring());
+  Coefficients.Add(Surface_CSF_Mnt, config->GetnMarker_Monitoring());
+  Coefficients.Add(Surface_CFx_Mnt, config->GetnMarker_Monitoring());
+  Coefficients.Add(Surface_CFy_Mnt, config->GetnMarker_Monitoring());
+  Coefficients.Add(Surface_CFz_Mnt, config->GetnMarker_Monitoring());
+  Coefficients.Add(Surface_CMx_Mnt, config->GetnMarker_Monitoring());
+  Coefficients.Add(Surface_CMy_Mnt, config->GetnMarker_Monitoring());
+  Coefficients.Add(Surface_CMz_Mnt, config->GetnMarker_Monitoring());
+  Coefficients.Reduce();
+  
   AllBound_CEff_Mnt = AllBound_CL_Mnt / (AllBound_CD_Mnt + EPS);
-  SU2_MPI::Allreduce(&MyAllBound_CFx_Mnt, &AllBound_CFx_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CFy_Mnt, &AllBound_CFy_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CFz_Mnt, &AllBound_CFz_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CMx_Mnt, &AllBound_CMx_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CMy_Mnt, &AllBound_CMy_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CMz_Mnt, &AllBound_CMz_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CoPx_Mnt, &AllBound_CoPx_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CoPy_Mnt, &AllBound_CoPy_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CoPz_Mnt, &AllBound_CoPz_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CT_Mnt, &AllBound_CT_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CQ_Mnt, &AllBound_CQ_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
   AllBound_CMerit_Mnt = AllBound_CT_Mnt / (AllBound_CQ_Mnt + EPS);
-  
-  /*--- Add the forces on the surfaces using all the nodes ---*/
-  
-  MySurface_CL_Mnt      = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CD_Mnt      = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CSF_Mnt = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CEff_Mnt       = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFx_Mnt        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFy_Mnt        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFz_Mnt        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMx_Mnt        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMy_Mnt        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMz_Mnt        = new su2double[config->GetnMarker_Monitoring()];
-  
-  for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
-    MySurface_CL_Mnt[iMarker_Monitoring]      = Surface_CL_Mnt[iMarker_Monitoring];
-    MySurface_CD_Mnt[iMarker_Monitoring]      = Surface_CD_Mnt[iMarker_Monitoring];
-    MySurface_CSF_Mnt[iMarker_Monitoring] = Surface_CSF_Mnt[iMarker_Monitoring];
-    MySurface_CEff_Mnt[iMarker_Monitoring]       = Surface_CEff_Mnt[iMarker_Monitoring];
-    MySurface_CFx_Mnt[iMarker_Monitoring]        = Surface_CFx_Mnt[iMarker_Monitoring];
-    MySurface_CFy_Mnt[iMarker_Monitoring]        = Surface_CFy_Mnt[iMarker_Monitoring];
-    MySurface_CFz_Mnt[iMarker_Monitoring]        = Surface_CFz_Mnt[iMarker_Monitoring];
-    MySurface_CMx_Mnt[iMarker_Monitoring]        = Surface_CMx_Mnt[iMarker_Monitoring];
-    MySurface_CMy_Mnt[iMarker_Monitoring]        = Surface_CMy_Mnt[iMarker_Monitoring];
-    MySurface_CMz_Mnt[iMarker_Monitoring]        = Surface_CMz_Mnt[iMarker_Monitoring];
-    
-    Surface_CL_Mnt[iMarker_Monitoring]         = 0.0;
-    Surface_CD_Mnt[iMarker_Monitoring]         = 0.0;
-    Surface_CSF_Mnt[iMarker_Monitoring]        = 0.0;
-    Surface_CEff_Mnt[iMarker_Monitoring]       = 0.0;
-    Surface_CFx_Mnt[iMarker_Monitoring]        = 0.0;
-    Surface_CFy_Mnt[iMarker_Monitoring]        = 0.0;
-    Surface_CFz_Mnt[iMarker_Monitoring]        = 0.0;
-    Surface_CMx_Mnt[iMarker_Monitoring]        = 0.0;
-    Surface_CMy_Mnt[iMarker_Monitoring]        = 0.0;
-    Surface_CMz_Mnt[iMarker_Monitoring]        = 0.0;
-  }
-  
-  SU2_MPI::Allreduce(MySurface_CL_Mnt, Surface_CL_Mnt, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CD_Mnt, Surface_CD_Mnt, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CSF_Mnt, Surface_CSF_Mnt, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
   for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++)
     Surface_CEff_Mnt[iMarker_Monitoring] = Surface_CL_Mnt[iMarker_Monitoring] / (Surface_CD_Mnt[iMarker_Monitoring] + EPS);
-  SU2_MPI::Allreduce(MySurface_CFx_Mnt, Surface_CFx_Mnt, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CFy_Mnt, Surface_CFy_Mnt, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CFz_Mnt, Surface_CFz_Mnt, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CMx_Mnt, Surface_CMx_Mnt, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CMy_Mnt, Surface_CMy_Mnt, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CMz_Mnt, Surface_CMz_Mnt, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  
-  delete [] MySurface_CL_Mnt; delete [] MySurface_CD_Mnt; delete [] MySurface_CSF_Mnt;
-  delete [] MySurface_CEff_Mnt;  delete [] MySurface_CFx_Mnt;   delete [] MySurface_CFy_Mnt;
-  delete [] MySurface_CFz_Mnt;
-  delete [] MySurface_CMx_Mnt;   delete [] MySurface_CMy_Mnt;  delete [] MySurface_CMz_Mnt;
   
 #endif
   
@@ -6427,42 +5595,66 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
 }
 
 void CEulerSolver::SetPrimitive_Gradient_GG(CGeometry *geometry, CConfig *config) {
-  unsigned long iPoint, jPoint, iEdge, iVertex;
+  unsigned long iPoint, jPoint, iEdge, iVertex, *Nodes;
   unsigned short iDim, iVar, iMarker;
-  su2double *PrimVar_Vertex, *PrimVar_i, *PrimVar_j, PrimVar_Average,
-  Partial_Gradient, Partial_Res, *Normal;
+  su2double *PrimVar_i, *PrimVar_j, *Gradient_i, *Gradient_j, PrimVar_Average,
+  Partial_Res, *Normal, Vol, du;
+  bool domain_i, domain_j;
   
-  /*--- Gradient primitive variables compressible (temp, vx, vy, vz, P, rho) ---*/
-
-  PrimVar_Vertex = new su2double [nPrimVarGrad];
-  PrimVar_i = new su2double [nPrimVarGrad];
-  PrimVar_j = new su2double [nPrimVarGrad];
+  /*--- Gradient primitive variables compressible (temp, vx, vy, vz, P, rho).
+   The primitives and their gradients are read from the contiguous storage. ---*/
   
   /*--- Set Gradient_Primitive to zero ---*/
   
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
-    node[iPoint]->SetGradient_PrimitiveZero(nPrimVarGrad);
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    Gradient_i = node_storage.GetGradient_Primitive(iPoint);
+    for (iVar = 0; iVar < nPrimVarGrad*nDim; iVar++)
+      Gradient_i[iVar] = 0.0;
+  }
+
+  /*--- Initialize the neighbor bounds of the limiter, if they are accumulated here ---*/
+  
+  if (Fused_Limiter_Bounds) {
+    for (iPoint = 0; iPoint < nPoint; iPoint++) {
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+        node[iPoint]->SetSolution_Max(iVar, -EPS);
+        node[iPoint]->SetSolution_Min(iVar, EPS);
+      }
+    }
+  }
 
   /*--- Loop interior edges ---*/
   
   for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
+    Nodes  = geometry->GetEdge_Nodes(iEdge);
+    iPoint = Nodes[0]; jPoint = Nodes[1];
     
-    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-      PrimVar_i[iVar] = node[iPoint]->GetPrimitive(iVar);
-      PrimVar_j[iVar] = node[jPoint]->GetPrimitive(iVar);
-    }
+    PrimVar_i  = node_storage.GetPrimitive(iPoint);
+    PrimVar_j  = node_storage.GetPrimitive(jPoint);
+    Gradient_i = node_storage.GetGradient_Primitive(iPoint);
+    Gradient_j = node_storage.GetGradient_Primitive(jPoint);
+    domain_i   = geometry->node[iPoint]->GetDomain();
+    domain_j   = geometry->node[jPoint]->GetDomain();
     
-    Normal = geometry->edge[iEdge]->GetNormal();
+    Normal = geometry->GetEdge_Normal(iEdge);
     for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
       PrimVar_Average =  0.5 * ( PrimVar_i[iVar] + PrimVar_j[iVar] );
       for (iDim = 0; iDim < nDim; iDim++) {
         Partial_Res = PrimVar_Average*Normal[iDim];
-        if (geometry->node[iPoint]->GetDomain())
-          node[iPoint]->AddGradient_Primitive(iVar, iDim, Partial_Res);
-        if (geometry->node[jPoint]->GetDomain())
-          node[jPoint]->SubtractGradient_Primitive(iVar, iDim, Partial_Res);
+        if (domain_i) Gradient_i[iVar*nDim+iDim] += Partial_Res;
+        if (domain_j) Gradient_j[iVar*nDim+iDim] -= Partial_Res;
+      }
+    }
+    
+    /*--- Maximum and minimum differences with the neighbors, for the limiter ---*/
+    
+    if (Fused_Limiter_Bounds) {
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+        du = (PrimVar_j[iVar] - PrimVar_i[iVar]);
+        node[iPoint]->SetSolution_Min(iVar, min(node[iPoint]->GetSolution_Min(iVar), du));
+        node[iPoint]->SetSolution_Max(iVar, max(node[iPoint]->GetSolution_Max(iVar), du));
+        node[jPoint]->SetSolution_Min(iVar, min(node[jPoint]->GetSolution_Min(iVar), -du));
+        node[jPoint]->SetSolution_Max(iVar, max(node[jPoint]->GetSolution_Max(iVar), -du));
       }
     }
   }
@@ -6476,15 +5668,13 @@ void CEulerSolver::SetPrimitive_Gradient_GG(CGeometry *geometry, CConfig *config
       iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
       if (geometry->node[iPoint]->GetDomain()) {
         
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          PrimVar_Vertex[iVar] = node[iPoint]->GetPrimitive(iVar);
+        PrimVar_i  = node_storage.GetPrimitive(iPoint);
+        Gradient_i = node_storage.GetGradient_Primitive(iPoint);
         
         Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
         for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++) {
-            Partial_Res = PrimVar_Vertex[iVar]*Normal[iDim];
-            node[iPoint]->SubtractGradient_Primitive(iVar, iDim, Partial_Res);
-          }
+          for (iDim = 0; iDim < nDim; iDim++)
+            Gradient_i[iVar*nDim+iDim] -= PrimVar_i[iVar]*Normal[iDim];
       }
     }
   }
@@ -6492,18 +5682,12 @@ void CEulerSolver::SetPrimitive_Gradient_GG(CGeometry *geometry, CConfig *config
   /*--- Update gradient value ---*/
   
   for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Partial_Gradient = node[iPoint]->GetGradient_Primitive(iVar, iDim) / (geometry->node[iPoint]->GetVolume());
-        node[iPoint]->SetGradient_Primitive(iVar, iDim, Partial_Gradient);
-      }
-    }
+    Gradient_i = node_storage.GetGradient_Primitive(iPoint);
+    Vol = geometry->GetPoint_Volume(iPoint);
+    for (iVar = 0; iVar < nPrimVarGrad*nDim; iVar++)
+      Gradient_i[iVar] /= Vol;
   }
 
-  delete [] PrimVar_Vertex;
-  delete [] PrimVar_i;
-  delete [] PrimVar_j;
-
   Set_MPI_Primitive_Gradient(geometry, config);
 
 }
@@ -6514,8 +5698,82 @@ void CEulerSolver::SetPrimitive_Gradient_LS(CGeometry *geometry, CConfig *config
   unsigned long iPoint, jPoint;
   su2double *PrimVar_i, *PrimVar_j, *Coord_i, *Coord_j, r11, r12, r13, r22, r23, r23_a,
   r23_b, r33, weight, product, z11, z12, z13, z22, z23, z33, detR2;
+  su2double *Var_i, *Var_j, *Weight, *Smatrix_i, du;
   bool singular;
   
+  /*--- Unless the coordinates are recorded for AD, the geometric part of the
+   least-squares problem is taken from the data stored in the geometry ---*/
+  
+  if (!config->GetAD_Mode()) {
+    
+    geometry->SetLeastSquares_Weights();
+    
+    /*--- Initialize the neighbor bounds of the limiter, if they are accumulated here ---*/
+    
+    if (Fused_Limiter_Bounds) {
+      for (iPoint = 0; iPoint < nPoint; iPoint++) {
+        for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+          node[iPoint]->SetSolution_Max(iVar, -EPS);
+          node[iPoint]->SetSolution_Min(iVar, EPS);
+        }
+      }
+    }
+    
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      
+      Var_i = node[iPoint]->GetPrimitive();
+      Weight = geometry->GetLeastSquares_Weights(iPoint);
+      Smatrix_i = geometry->GetLeastSquares_Smatrix(iPoint);
+      
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+        for (iDim = 0; iDim < nDim; iDim++)
+          Cvector[iVar][iDim] = 0.0;
+      
+      /*--- Entries of c:= transpose(A)*b ---*/
+      
+      for (iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++, Weight += nDim+1) {
+        jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
+        Var_j = node[jPoint]->GetPrimitive();
+        
+        /*--- Maximum and minimum differences with the neighbors, for the limiter ---*/
+        
+        if (Fused_Limiter_Bounds) {
+          for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+            du = (Var_j[iVar] - Var_i[iVar]);
+            node[iPoint]->SetSolution_Min(iVar, min(node[iPoint]->GetSolution_Min(iVar), du));
+            node[iPoint]->SetSolution_Max(iVar, max(node[iPoint]->GetSolution_Max(iVar), du));
+          }
+        }
+        
+        if (Weight[nDim] == 0.0) continue;
+        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+          for (iDim = 0; iDim < nDim; iDim++)
+            Cvector[iVar][iDim] += Weight[iDim]*(Var_j[iVar]-Var_i[iVar])/Weight[nDim];
+      }
+      
+      /*--- Computation of the gradient: S*c ---*/
+      
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+        for (iDim = 0; iDim < nDim; iDim++) {
+          product = 0.0;
+          for (jDim = 0; jDim < nDim; jDim++)
+            product += Smatrix_i[iDim*nDim+jDim]*Cvector[iVar][jDim];
+          node[iPoint]->SetGradient_Primitive(iVar, iDim, product);
+        }
+      }
+      
+    }
+    
+    Set_MPI_Primitive_Gradient(geometry, config);
+    
+    return;
+    
+  }
+  
+  /*--- The neighbor bounds of the limiter are left to SetPrimitive_Limiter ---*/
+  
+  Fused_Limiter_Bounds = false;
+  
   /*--- Loop over points of the grid ---*/
   
   for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
@@ -6676,40 +5934,45 @@ void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
   
   else {
     
-    /*--- Initialize solution max and solution min and the limiter in the entire domain --*/
+    /*--- Initialize the limiter in the entire domain, and the solution max and min
+     unless they were accumulated by the gradient computation --*/
     
     for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
       for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-        node[iPoint]->SetSolution_Max(iVar, -EPS);
-        node[iPoint]->SetSolution_Min(iVar, EPS);
+        if (!Fused_Limiter_Bounds) {
+          node[iPoint]->SetSolution_Max(iVar, -EPS);
+          node[iPoint]->SetSolution_Min(iVar, EPS);
+        }
         node[iPoint]->SetLimiter_Primitive(iVar, 2.0);
       }
     }
     
     /*--- Establish bounds for Spekreijse monotonicity by finding max & min values of neighbor variables --*/
     
-    for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+    if (!Fused_Limiter_Bounds) {
+      for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
       
-      /*--- Point identification, Normal vector and area ---*/
+        /*--- Point identification, Normal vector and area ---*/
       
-      iPoint = geometry->edge[iEdge]->GetNode(0);
-      jPoint = geometry->edge[iEdge]->GetNode(1);
+        iPoint = geometry->edge[iEdge]->GetNode(0);
+        jPoint = geometry->edge[iEdge]->GetNode(1);
       
-      /*--- Get the primitive variables ---*/
+        /*--- Get the primitive variables ---*/
       
-      Primitive_i = node[iPoint]->GetPrimitive();
-      Primitive_j = node[jPoint]->GetPrimitive();
+        Primitive_i = node[iPoint]->GetPrimitive();
+        Primitive_j = node[jPoint]->GetPrimitive();
       
-      /*--- Compute the maximum, and minimum values for nodes i & j ---*/
+        /*--- Compute the maximum, and minimum values for nodes i & j ---*/
       
-      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-        du = (Primitive_j[iVar] - Primitive_i[iVar]);
-        node[iPoint]->SetSolution_Min(iVar, min(node[iPoint]->GetSolution_Min(iVar), du));
-        node[iPoint]->SetSolution_Max(iVar, max(node[iPoint]->GetSolution_Max(iVar), du));
-        node[jPoint]->SetSolution_Min(iVar, min(node[jPoint]->GetSolution_Min(iVar), -du));
-        node[jPoint]->SetSolution_Max(iVar, max(node[jPoint]->GetSolution_Max(iVar), -du));
-      }
+        for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+          du = (Primitive_j[iVar] - Primitive_i[iVar]);
+          node[iPoint]->SetSolution_Min(iVar, min(node[iPoint]->GetSolution_Min(iVar), du));
+          node[iPoint]->SetSolution_Max(iVar, max(node[iPoint]->GetSolution_Max(iVar), du));
+          node[jPoint]->SetSolution_Min(iVar, min(node[jPoint]->GetSolution_Min(iVar), -du));
+          node[jPoint]->SetSolution_Max(iVar, max(node[jPoint]->GetSolution_Max(iVar), -du));
+        }
       
+      }
     }
     
   }
@@ -6801,36 +6064,41 @@ void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
     LocalMinPrimitive = new su2double [nPrimVarGrad]; GlobalMinPrimitive = new su2double [nPrimVarGrad];
     LocalMaxPrimitive = new su2double [nPrimVarGrad]; GlobalMaxPrimitive = new su2double [nPrimVarGrad];
     
-    /*--- Compute the max value and min value of the solution ---*/
+    /*--- Compute the max value and min value of the solution, only needed
+     to scale the Wang variant of the limiter ---*/
     
-    Primitive = node[0]->GetPrimitive();
-    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-      LocalMinPrimitive[iVar] = Primitive[iVar];
-      LocalMaxPrimitive[iVar] = Primitive[iVar];
-    }
+    if (config->GetKind_SlopeLimit_Flow() == VENKATAKRISHNAN_WANG) {
+      
+      Primitive = node[0]->GetPrimitive();
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+        LocalMinPrimitive[iVar] = Primitive[iVar];
+        LocalMaxPrimitive[iVar] = Primitive[iVar];
+      }
     
-    for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+      for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
       
-      /*--- Get the primitive variables ---*/
+        /*--- Get the primitive variables ---*/
       
-      Primitive = node[iPoint]->GetPrimitive();
+        Primitive = node[iPoint]->GetPrimitive();
       
-      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-        LocalMinPrimitive[iVar] = min (LocalMinPrimitive[iVar], Primitive[iVar]);
-        LocalMaxPrimitive[iVar] = max (LocalMaxPrimitive[iVar], Primitive[iVar]);
-      }
+        for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+          LocalMinPrimitive[iVar] = min (LocalMinPrimitive[iVar], Primitive[iVar]);
+          LocalMaxPrimitive[iVar] = max (LocalMaxPrimitive[iVar], Primitive[iVar]);
+        }
       
-    }
+      }
     
 #ifdef HAVE_MPI
-    SU2_MPI::Allreduce(LocalMinPrimitive, GlobalMinPrimitive, nPrimVarGrad, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(LocalMaxPrimitive, GlobalMaxPrimitive, nPrimVarGrad, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+      SU2_MPI::Allreduce(LocalMinPrimitive, GlobalMinPrimitive, nPrimVarGrad, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+      SU2_MPI::Allreduce(LocalMaxPrimitive, GlobalMaxPrimitive, nPrimVarGrad, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
 #else
-    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-      GlobalMinPrimitive[iVar] = LocalMinPrimitive[iVar];
-      GlobalMaxPrimitive[iVar] = LocalMaxPrimitive[iVar];
-    }
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+        GlobalMinPrimitive[iVar] = LocalMinPrimitive[iVar];
+        GlobalMaxPrimitive[iVar] = LocalMaxPrimitive[iVar];
+      }
 #endif
+      
+    }
     
     for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
       
@@ -6908,6 +6176,10 @@ void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
     
   }
 
+  /*--- The bounds accumulated by the gradient computation have been used ---*/
+  
+  Fused_Limiter_Bounds = false;
+  
   /*--- Limiter MPI ---*/
   
   Set_MPI_Primitive_Limiter(geometry, config);
@@ -15697,6 +14969,10 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
   for (iPoint = 0; iPoint < nPoint; iPoint++)
     node[iPoint] = new CNSVariable(Density_Inf, Velocity_Inf, Energy_Inf, nDim, nVar, config);
 
+  /*--- Store the fields of all the points contiguously ---*/
+
+  SetVariable_Storage(nPrimVar, nPrimVarGrad, nSecondaryVar);
+
   /*--- Check that the initial solution is physical, report any non-physical nodes ---*/
 
   counter_local = 0;
@@ -15838,6 +15114,7 @@ CNSSolver::~CNSSolver(void) {
 void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
 
   unsigned long iPoint, ErrorCounter = 0;
+  unsigned short nComm, commType[3];
   su2double StrainMag = 0.0, Omega = 0.0, *Vorticity;
     
   unsigned long ExtIter     = config->GetExtIter();
@@ -15885,14 +15162,18 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
 
   if (nearfield) { Set_MPI_Nearfield(geometry, config); }
  
-  /*--- Artificial dissipation ---*/
+  /*--- Artificial dissipation, the halo values of all its quantities
+   are exchanged in a single message per neighbor. ---*/
 
   if (center && !Output) {
-    SetMax_Eigenvalue(geometry, config);
+    nComm = 0;
+    SetMax_Eigenvalue(geometry, config); commType[nComm++] = COMM_MAX_EIGENVALUE;
     if ((center_jst) && (iMesh == MESH_0)) {
-      SetCentered_Dissipation_Sensor(geometry, config);
-      SetUndivided_Laplacian(geometry, config);
+      SetCentered_Dissipation_Sensor(geometry, config); commType[nComm++] = COMM_SENSOR;
+      SetUndivided_Laplacian(geometry, config); commType[nComm++] = COMM_UNDIVIDED_LAPLACIAN;
     }
+    InitiateComms(geometry, config, nComm, commType);
+    CompleteComms(geometry, config, nComm, commType);
   }
   
   /*--- Roe Low Dissipation Sensor ---*/
@@ -15904,7 +15185,10 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
     }
   }
   
-  /*--- Compute gradient of the primitive variables ---*/
+  /*--- Compute gradient of the primitive variables, the neighbor bounds
+   of the flow limiter are accumulated in the same pass over the grid ---*/
+  
+  Fused_Limiter_Bounds = ((iMesh == MESH_0) && limiter_flow && !Output && !van_albada);
   
   if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
     SetPrimitive_Gradient_GG(geometry, config);
@@ -16216,50 +15500,126 @@ void CNSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CC
 void CNSSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                                  CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
   
-  unsigned long iPoint, jPoint, iEdge;
-  
   bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool sst = (config->GetKind_Turb_Model() == SST);
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  /*--- Packs of edges are computed by the schemes that support them (the QCR
+   stress tensor and the AD preaccumulation use the edge-by-edge version) ---*/
+  
+  bool batched = (config->GetBatched_Visc_Flow() && numerics->GetBatched() &&
+                  !config->GetQCR() && !config->GetAD_Mode());
+  
+  /*--- Edges of the same color do not share points, hence they are processed
+   concurrently when several threads are available. ---*/
+  
+  unsigned short nEdgeColor = geometry->GetnEdgeColor();
+  unsigned long *EdgeColor_Ptr = geometry->GetEdgeColor_Ptr(), *EdgeColor_Edge = geometry->GetEdgeColor_Edge();
+  bool threaded = (nEdgeColor > 1);
+  
+  SU2_OMP(parallel if(threaded))
+  {
     
-    /*--- Points, coordinates and normal vector in edge ---*/
+    unsigned short iVar, iColor, iLane, iThread = OMP::GetThreadNum();
+    unsigned long iColorEdge, iEdge, iPoint, jPoint, *Nodes;
     
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    numerics->SetCoord(geometry->node[iPoint]->GetCoord(), geometry->node[jPoint]->GetCoord());
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+    /*--- Each thread uses its own numerics, pack of edges, and residual/Jacobian
+     containers (the first thread uses the ones of the solver) ---*/
+    
+    CNumerics *edge_numerics = numerics->GetThread_Numerics(iThread);
+    
+    CNumericsBatch *Batch = NULL;
+    if (batched) Batch = new CNumericsBatch(nDim, nVar, true);
+    
+    su2double *Res = Res_Visc, **Jac_i = Jacobian_i, **Jac_j = Jacobian_j;
+    
+    if (iThread > 0) {
+      Res   = new su2double[nVar];
+      Jac_i = new su2double*[nVar]; Jac_j = new su2double*[nVar];
+      for (iVar = 0; iVar < nVar; iVar++) {
+        Jac_i[iVar] = new su2double[nVar]; Jac_j[iVar] = new su2double[nVar];
+      }
+    }
     
-    /*--- Primitive and secondary variables ---*/
+    for (iColor = 0; iColor < nEdgeColor; iColor++) {
+      
+      SU2_OMP(for schedule(static))
+      for (iColorEdge = EdgeColor_Ptr[iColor]; iColorEdge < EdgeColor_Ptr[iColor+1]; iColorEdge++) {
+        
+        iEdge = EdgeColor_Edge[iColorEdge];
+    
+        /*--- Points, coordinates and normal vector in edge ---*/
+    
+        Nodes = geometry->GetEdge_Nodes(iEdge);
+        iPoint = Nodes[0]; jPoint = Nodes[1];
+        
+        /*--- Add the edge to the pack, which is computed once it is full ---*/
+        
+        if (batched) {
+          iLane = Batch->AddEdge(iEdge, iPoint, jPoint, geometry->GetEdge_Normal(iEdge),
+                                 node_storage.GetPrimitive(iPoint), node_storage.GetPrimitive(jPoint));
+          Batch->SetCoord(iLane, geometry->GetPoint_Coord(iPoint), geometry->GetPoint_Coord(jPoint));
+          Batch->SetPrimVarGradient(iLane, node_storage.GetGradient_Primitive(iPoint), node_storage.GetGradient_Primitive(jPoint));
+          if (sst)
+            Batch->SetTurbKineticEnergy(iLane, solver_container[TURB_SOL]->node[iPoint]->GetSolution(0),
+                                        solver_container[TURB_SOL]->node[jPoint]->GetSolution(0));
+          if (Batch->GetnEdge() == BATCH_SIZE)
+            Batch_Residual(edge_numerics, Batch, Res, implicit, true, config);
+          continue;
+        }
+        
+        edge_numerics->SetCoord(geometry->GetPoint_Coord(iPoint), geometry->GetPoint_Coord(jPoint));
+        edge_numerics->SetNormal(geometry->GetEdge_Normal(iEdge));
     
-    numerics->SetPrimitive(node[iPoint]->GetPrimitive(), node[jPoint]->GetPrimitive());
-    numerics->SetSecondary(node[iPoint]->GetSecondary(), node[jPoint]->GetSecondary());
+        /*--- Primitive and secondary variables ---*/
     
-    /*--- Gradient and limiters ---*/
+        edge_numerics->SetPrimitive(node_storage.GetPrimitive(iPoint), node_storage.GetPrimitive(jPoint));
+        edge_numerics->SetSecondary(node_storage.GetSecondary(iPoint), node_storage.GetSecondary(jPoint));
     
-    numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(), node[jPoint]->GetGradient_Primitive());
+        /*--- Gradient and limiters ---*/
     
-    /*--- Turbulent kinetic energy ---*/
+        edge_numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(), node[jPoint]->GetGradient_Primitive());
     
-    if (config->GetKind_Turb_Model() == SST)
-      numerics->SetTurbKineticEnergy(solver_container[TURB_SOL]->node[iPoint]->GetSolution(0),
-                                     solver_container[TURB_SOL]->node[jPoint]->GetSolution(0));
+        /*--- Turbulent kinetic energy ---*/
+    
+        if (sst)
+          edge_numerics->SetTurbKineticEnergy(solver_container[TURB_SOL]->node[iPoint]->GetSolution(0),
+                                         solver_container[TURB_SOL]->node[jPoint]->GetSolution(0));
     
-    /*--- Compute and update residual ---*/
+        /*--- Compute and update residual ---*/
     
-    numerics->ComputeResidual(Res_Visc, Jacobian_i, Jacobian_j, config);
+        edge_numerics->ComputeResidual(Res, Jac_i, Jac_j, config);
     
-    LinSysRes.SubtractBlock(iPoint, Res_Visc);
-    LinSysRes.AddBlock(jPoint, Res_Visc);
+        LinSysRes.SubtractBlock(iPoint, Res);
+        LinSysRes.AddBlock(jPoint, Res);
     
-    /*--- Implicit part ---*/
+        /*--- Implicit part ---*/
     
-    if (implicit) {
-      Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
-      Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_j);
-      Jacobian.AddBlock(jPoint, iPoint, Jacobian_i);
-      Jacobian.AddBlock(jPoint, jPoint, Jacobian_j);
+        if (implicit) {
+          Jacobian.UpdateBlocks_Sub(iEdge, Jac_i, Jac_j);
+        }
+      }
+      
+      /*--- Last (partial) pack of the color, all the threads must be done
+       with it before the points are updated by the next color ---*/
+      
+      if (batched) {
+        if (Batch->GetnEdge() > 0)
+          Batch_Residual(edge_numerics, Batch, Res, implicit, true, config);
+        SU2_OMP(barrier)
+      }
+      
+    }
+    
+    if (iThread > 0) {
+      for (iVar = 0; iVar < nVar; iVar++) {
+        delete [] Jac_i[iVar]; delete [] Jac_j[iVar];
+      }
+      delete [] Jac_i; delete [] Jac_j;
+      delete [] Res;
     }
     
+    if (Batch != NULL) delete Batch;
+    
   }
   
 }
@@ -16278,10 +15638,6 @@ void CNSSolver::Friction_Forces(CGeometry *geometry, CConfig *config) {
   su2double MomentX_Force[3] = {0.0,0.0,0.0}, MomentY_Force[3] = {0.0,0.0,0.0}, MomentZ_Force[3] = {0.0,0.0,0.0};
   su2double AxiFactor;
 
-#ifdef HAVE_MPI
-  su2double MyAllBound_CD_Visc, MyAllBound_CL_Visc, MyAllBound_CSF_Visc, MyAllBound_CMx_Visc, MyAllBound_CMy_Visc, MyAllBound_CMz_Visc, MyAllBound_CoPx_Visc, MyAllBound_CoPy_Visc, MyAllBound_CoPz_Visc, MyAllBound_CFx_Visc, MyAllBound_CFy_Visc, MyAllBound_CFz_Visc, MyAllBound_CT_Visc, MyAllBound_CQ_Visc, MyAllBound_HF_Visc, MyAllBound_MaxHF_Visc, *MySurface_CL_Visc = NULL, *MySurface_CD_Visc = NULL, *MySurface_CSF_Visc = NULL, *MySurface_CEff_Visc = NULL, *MySurface_CFx_Visc = NULL, *MySurface_CFy_Visc = NULL, *MySurface_CFz_Visc = NULL, *MySurface_CMx_Visc = NULL, *MySurface_CMy_Visc = NULL, *MySurface_CMz_Visc = NULL, *MySurface_HF_Visc = NULL, *MySurface_MaxHF_Visc;
-#endif
-  
   string Marker_Tag, Monitoring_Tag;
   
   su2double Alpha           = config->GetAoA()*PI_NUMBER/180.0;
@@ -16604,109 +15960,45 @@ void CNSSolver::Friction_Forces(CGeometry *geometry, CConfig *config) {
   
 #ifdef HAVE_MPI
   
-  /*--- Add AllBound information using all the nodes ---*/
-  
-  MyAllBound_CD_Visc        = AllBound_CD_Visc;                      AllBound_CD_Visc = 0.0;
-  MyAllBound_CL_Visc        = AllBound_CL_Visc;                      AllBound_CL_Visc = 0.0;
-  MyAllBound_CSF_Visc   = AllBound_CSF_Visc;                 AllBound_CSF_Visc = 0.0;
-  AllBound_CEff_Visc = 0.0;
-  MyAllBound_CMx_Visc          = AllBound_CMx_Visc;                        AllBound_CMx_Visc = 0.0;
-  MyAllBound_CMy_Visc          = AllBound_CMy_Visc;                        AllBound_CMy_Visc = 0.0;
-  MyAllBound_CMz_Visc          = AllBound_CMz_Visc;                        AllBound_CMz_Visc = 0.0;
-  MyAllBound_CoPx_Visc          = AllBound_CoPx_Visc;                        AllBound_CoPx_Visc = 0.0;
-  MyAllBound_CoPy_Visc          = AllBound_CoPy_Visc;                        AllBound_CoPy_Visc = 0.0;
-  MyAllBound_CoPz_Visc          = AllBound_CoPz_Visc;                        AllBound_CoPz_Visc = 0.0;
-  MyAllBound_CFx_Visc          = AllBound_CFx_Visc;                        AllBound_CFx_Visc = 0.0;
-  MyAllBound_CFy_Visc          = AllBound_CFy_Visc;                        AllBound_CFy_Visc = 0.0;
-  MyAllBound_CFz_Visc          = AllBound_CFz_Visc;                        AllBound_CFz_Visc = 0.0;
-  MyAllBound_CT_Visc           = AllBound_CT_Visc;                         AllBound_CT_Visc = 0.0;
-  MyAllBound_CQ_Visc           = AllBound_CQ_Visc;                         AllBound_CQ_Visc = 0.0;
-  AllBound_CMerit_Visc = 0.0;
-  MyAllBound_HF_Visc     = AllBound_HF_Visc;                   AllBound_HF_Visc = 0.0;
-  MyAllBound_MaxHF_Visc  = pow(AllBound_MaxHF_Visc, MaxNorm);  AllBound_MaxHF_Visc = 0.0;
-  
-  SU2_MPI::Allreduce(&MyAllBound_CD_Visc, &AllBound_CD_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CL_Visc, &AllBound_CL_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CSF_Visc, &AllBound_CSF_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  /*--- Add AllBound information and the forces on the surfaces using all
+   the nodes, with a single reduction for all the coefficients ---*/
+  
+  AllBound_MaxHF_Visc = pow(AllBound_MaxHF_Visc, MaxNorm);
+  CSumReduction Coefficients;
+  Coefficients.Add(&AllBound_CD_Visc);
+  Coefficients.Add(&AllBound_CL_Visc);
+  Coefficients.Add(&AllBound_CSF_Visc);
+  Coefficients.Add(&AllBound_CMx_Visc);
+  Coefficients.Add(&AllBound_CMy_Visc);
+  Coefficients.Add(&AllBound_CMz_Visc);
+  Coefficients.Add(&AllBound_CFx_Visc);
+  Coefficients.Add(&AllBound_CFy_Visc);
+  Coefficients.Add(&AllBound_CFz_Visc);
+  Coefficients.Add(&AllBound_CoPx_Visc);
+  Coefficients.Add(&AllBound_CoPy_Visc);
+  Coefficients.Add(&AllBound_CoPz_Visc);
+  Coefficients.Add(&AllBound_CT_Visc);
+  Coefficients.Add(&AllBound_CQ_Visc);
+  Coefficients.Add(&AllBound_HF_Visc);
+  Coefficients.Add(&AllBound_MaxHF_Visc);
+  Coefficients.Add(Surface_CL_Visc, config->GetnMarker_Monitoring());
+  Coefficients.Add(Surface_CD_Visc, config->GetnMarker_Monitoring());
+  Coefficients.Add(Surface_CSF_Visc, config->GetnMarker_Monitoring());
+  Coefficients.Add(Surface_CFx_Visc, config->GetnMarker_Monitoring());
+  Coefficients.Add(Surface_CFy_Visc, config->GetnMarker_Monitoring());
+  Coefficients.Add(Surface_CFz_Visc, config->GetnMarker_Monitoring());
+  Coefficients.Add(Surface_CMx_Visc, config->GetnMarker_Monitoring());
+  Coefficients.Add(Surface_CMy_Visc, config->GetnMarker_Monitoring());
+  Coefficients.Add(Surface_CMz_Visc, config->GetnMarker_Monitoring());
+  Coefficients.Add(Surface_HF_Visc, config->GetnMarker_Monitoring());
+  Coefficients.Add(Surface_MaxHF_Visc, config->GetnMarker_Monitoring());
+  Coefficients.Reduce();
+  
   AllBound_CEff_Visc = AllBound_CL_Visc / (AllBound_CD_Visc + EPS);
-  SU2_MPI::Allreduce(&MyAllBound_CMx_Visc, &AllBound_CMx_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CMy_Visc, &AllBound_CMy_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CMz_Visc, &AllBound_CMz_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CFx_Visc, &AllBound_CFx_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CFy_Visc, &AllBound_CFy_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CFz_Visc, &AllBound_CFz_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CoPx_Visc, &AllBound_CoPx_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CoPy_Visc, &AllBound_CoPy_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CoPz_Visc, &AllBound_CoPz_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CT_Visc, &AllBound_CT_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CQ_Visc, &AllBound_CQ_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
   AllBound_CMerit_Visc = AllBound_CT_Visc / (AllBound_CQ_Visc + EPS);
-  SU2_MPI::Allreduce(&MyAllBound_HF_Visc, &AllBound_HF_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_MaxHF_Visc, &AllBound_MaxHF_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
   AllBound_MaxHF_Visc = pow(AllBound_MaxHF_Visc, 1.0/MaxNorm);
-  
-  /*--- Add the forces on the surfaces using all the nodes ---*/
-  
-  MySurface_CL_Visc         = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CD_Visc         = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CSF_Visc        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CEff_Visc       = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFx_Visc        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFy_Visc        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFz_Visc        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMx_Visc        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMy_Visc        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMz_Visc        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_HF_Visc         = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_MaxHF_Visc      = new su2double[config->GetnMarker_Monitoring()];
-  
-  for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
-    
-    MySurface_CL_Visc[iMarker_Monitoring]      = Surface_CL_Visc[iMarker_Monitoring];
-    MySurface_CD_Visc[iMarker_Monitoring]      = Surface_CD_Visc[iMarker_Monitoring];
-    MySurface_CSF_Visc[iMarker_Monitoring] = Surface_CSF_Visc[iMarker_Monitoring];
-    MySurface_CEff_Visc[iMarker_Monitoring]       = Surface_CEff_Visc[iMarker_Monitoring];
-    MySurface_CFx_Visc[iMarker_Monitoring]        = Surface_CFx_Visc[iMarker_Monitoring];
-    MySurface_CFy_Visc[iMarker_Monitoring]        = Surface_CFy_Visc[iMarker_Monitoring];
-    MySurface_CFz_Visc[iMarker_Monitoring]        = Surface_CFz_Visc[iMarker_Monitoring];
-    MySurface_CMx_Visc[iMarker_Monitoring]        = Surface_CMx_Visc[iMarker_Monitoring];
-    MySurface_CMy_Visc[iMarker_Monitoring]        = Surface_CMy_Visc[iMarker_Monitoring];
-    MySurface_CMz_Visc[iMarker_Monitoring]        = Surface_CMz_Visc[iMarker_Monitoring];
-    MySurface_HF_Visc[iMarker_Monitoring]         = Surface_HF_Visc[iMarker_Monitoring];
-    MySurface_MaxHF_Visc[iMarker_Monitoring]      = Surface_MaxHF_Visc[iMarker_Monitoring];
-    
-    Surface_CL_Visc[iMarker_Monitoring]         = 0.0;
-    Surface_CD_Visc[iMarker_Monitoring]         = 0.0;
-    Surface_CSF_Visc[iMarker_Monitoring]        = 0.0;
-    Surface_CEff_Visc[iMarker_Monitoring]       = 0.0;
-    Surface_CFx_Visc[iMarker_Monitoring]        = 0.0;
-    Surface_CFy_Visc[iMarker_Monitoring]        = 0.0;
-    Surface_CFz_Visc[iMarker_Monitoring]        = 0.0;
-    Surface_CMx_Visc[iMarker_Monitoring]        = 0.0;
-    Surface_CMy_Visc[iMarker_Monitoring]        = 0.0;
-    Surface_CMz_Visc[iMarker_Monitoring]        = 0.0;
-    Surface_HF_Visc[iMarker_Monitoring]         = 0.0;
-    Surface_MaxHF_Visc[iMarker_Monitoring]      = 0.0;
-  }
-  
-  SU2_MPI::Allreduce(MySurface_CL_Visc, Surface_CL_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CD_Visc, Surface_CD_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CSF_Visc, Surface_CSF_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
   for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++)
     Surface_CEff_Visc[iMarker_Monitoring] = Surface_CL_Visc[iMarker_Monitoring] / (Surface_CD_Visc[iMarker_Monitoring] + EPS);
-  SU2_MPI::Allreduce(MySurface_CFx_Visc, Surface_CFx_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CFy_Visc, Surface_CFy_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CFz_Visc, Surface_CFz_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CMx_Visc, Surface_CMx_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CMy_Visc, Surface_CMy_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CMz_Visc, Surface_CMz_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_HF_Visc, Surface_HF_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_MaxHF_Visc, Surface_MaxHF_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  
-  delete [] MySurface_CL_Visc; delete [] MySurface_CD_Visc; delete [] MySurface_CSF_Visc;
-  delete [] MySurface_CEff_Visc;  delete [] MySurface_CFx_Visc;   delete [] MySurface_CFy_Visc;
-  delete [] MySurface_CFz_Visc;   delete [] MySurface_CMx_Visc;   delete [] MySurface_CMy_Visc;
-  delete [] MySurface_CMz_Visc;   delete [] MySurface_HF_Visc; delete [] MySurface_MaxHF_Visc;
   
 #endif
   
@@ -81,6 +81,7 @@ CSolver::CSolver(void) {
   Restart_Data       = NULL;
   node               = NULL;
   nOutputVariables   = 0;
+  Periodic_Vectors   = false;
   
 }
 
@@ -196,6 +197,237 @@ CSolver::~CSolver(void) {
 
 }
 
+void CSolver::SetVariable_Storage(unsigned short val_nprimvar, unsigned short val_nprimvargrad, unsigned short val_nsecondaryvar) {
+
+  unsigned long iPoint;
+
+  /*--- Allocate the point-major arrays once and hand each variable its slice,
+   the values set by the constructors of the variables are preserved. ---*/
+
+  node_storage.Initialize(nPoint, nDim, nVar, val_nprimvar, val_nprimvargrad, val_nsecondaryvar);
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    node[iPoint]->SetStorage(&node_storage, iPoint);
+
+}
+
+unsigned short CSolver::GetComms_CountPerPoint(unsigned short commType) {
+
+  switch (commType) {
+    case COMM_SOLUTION: case COMM_SOLUTION_OLD:
+    case COMM_SOLUTION_LIMITER: case COMM_UNDIVIDED_LAPLACIAN:
+      return nVar;
+    case COMM_SOLUTION_EDDY:
+      return nVar+1;
+    case COMM_SOLUTION_GRADIENT:
+      return nVar*nDim;
+    case COMM_PRIMITIVE_GRADIENT:
+      return nPrimVarGrad*nDim;
+    case COMM_PRIMITIVE_LIMITER:
+      return nPrimVarGrad;
+    case COMM_SENSOR:
+      return 1;
+    case COMM_MAX_EIGENVALUE:
+      return 2;
+    default:
+      SU2_MPI::Error("Unrecognized quantity for the halo communications.", CURRENT_FUNCTION);
+      return 0;
+  }
+
+}
+
+void CSolver::InitiateComms(CGeometry *geometry, CConfig *config, unsigned short commType) {
+
+  InitiateComms(geometry, config, 1, &commType);
+
+}
+
+void CSolver::CompleteComms(CGeometry *geometry, CConfig *config, unsigned short commType) {
+
+  CompleteComms(geometry, config, 1, &commType);
+
+}
+
+void CSolver::InitiateComms(CGeometry *geometry, CConfig *config, unsigned short val_nComm, const unsigned short *val_commType) {
+
+  unsigned short iComm, nVal = 0, offset;
+  unsigned long iSend;
+  su2double *buf;
+
+  if (!geometry->P2PComms_Preprocessed) geometry->PreprocessP2PComms(config);
+
+  for (iComm = 0; iComm < val_nComm; iComm++)
+    nVal += GetComms_CountPerPoint(val_commType[iComm]);
+  geometry->AllocateP2PComms(nVal);
+
+  /*--- Post the receives first, then pack and send. The values of each point are
+   contiguous, with the quantities one after the other, so that all of them travel
+   in a single message per neighbor. ---*/
+
+  geometry->PostP2PRecvs(nVal);
+
+  for (iSend = 0; iSend < geometry->P2PSend_Ptr[geometry->nP2PSend]; iSend++) {
+    buf = &geometry->P2PSend_Buffer[iSend*nVal];
+    for (iComm = 0, offset = 0; iComm < val_nComm; iComm++) {
+      PackComms_Point(geometry, val_commType[iComm], geometry->P2PSend_Point[iSend], &buf[offset]);
+      offset += GetComms_CountPerPoint(val_commType[iComm]);
+    }
+  }
+
+  geometry->PostP2PSends(nVal);
+
+}
+
+void CSolver::CompleteComms(CGeometry *geometry, CConfig *config, unsigned short val_nComm, const unsigned short *val_commType) {
+
+  unsigned short iComm, nVal = 0, offset;
+  unsigned long iRecv;
+  int iMessage, jMessage;
+  su2double *buf, *rotMatrix;
+
+  for (iComm = 0; iComm < val_nComm; iComm++)
+    nVal += GetComms_CountPerPoint(val_commType[iComm]);
+
+  /*--- Unpack the messages in the order in which they arrive. ---*/
+
+  for (jMessage = 0; jMessage < geometry->nP2PRecv; jMessage++) {
+
+    iMessage = geometry->WaitAnyP2PRecv(jMessage);
+
+    for (iRecv = geometry->P2PRecv_Ptr[iMessage]; iRecv < geometry->P2PRecv_Ptr[iMessage+1]; iRecv++) {
+      buf = &geometry->P2PRecv_Buffer[iRecv*nVal];
+      rotMatrix = &geometry->P2P_RotMatrix[geometry->P2PRecv_Rotation[iRecv]*9];
+      for (iComm = 0, offset = 0; iComm < val_nComm; iComm++) {
+        UnpackComms_Point(geometry, val_commType[iComm], geometry->P2PRecv_Point[iRecv], rotMatrix, &buf[offset]);
+        offset += GetComms_CountPerPoint(val_commType[iComm]);
+      }
+    }
+  }
+
+  /*--- The send buffer may be reused by the next exchange only after the sends complete. ---*/
+
+  geometry->WaitAllP2PSends();
+
+}
+
+void CSolver::PackComms_Point(CGeometry *geometry, unsigned short commType, unsigned long iPoint, su2double *buf) {
+
+  unsigned short iVar, iDim;
+
+  switch (commType) {
+    case COMM_SOLUTION:
+      for (iVar = 0; iVar < nVar; iVar++) buf[iVar] = node[iPoint]->GetSolution(iVar);
+      break;
+    case COMM_SOLUTION_OLD:
+      for (iVar = 0; iVar < nVar; iVar++) buf[iVar] = node[iPoint]->GetSolution_Old(iVar);
+      break;
+    case COMM_SOLUTION_EDDY:
+      for (iVar = 0; iVar < nVar; iVar++) buf[iVar] = node[iPoint]->GetSolution(iVar);
+      buf[nVar] = node[iPoint]->GetmuT();
+      break;
+    case COMM_SOLUTION_GRADIENT:
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (iDim = 0; iDim < nDim; iDim++)
+          buf[iVar*nDim+iDim] = node[iPoint]->GetGradient(iVar, iDim);
+      break;
+    case COMM_SOLUTION_LIMITER:
+      for (iVar = 0; iVar < nVar; iVar++) buf[iVar] = node[iPoint]->GetLimiter(iVar);
+      break;
+    case COMM_PRIMITIVE_GRADIENT:
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+        for (iDim = 0; iDim < nDim; iDim++)
+          buf[iVar*nDim+iDim] = node[iPoint]->GetGradient_Primitive(iVar, iDim);
+      break;
+    case COMM_PRIMITIVE_LIMITER:
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++) buf[iVar] = node[iPoint]->GetLimiter_Primitive(iVar);
+      break;
+    case COMM_UNDIVIDED_LAPLACIAN:
+      for (iVar = 0; iVar < nVar; iVar++) buf[iVar] = node[iPoint]->GetUndivided_Laplacian(iVar);
+      break;
+    case COMM_SENSOR:
+      buf[0] = node[iPoint]->GetSensor();
+      break;
+    case COMM_MAX_EIGENVALUE:
+      buf[0] = node[iPoint]->GetLambda();
+      buf[1] = geometry->node[iPoint]->GetnPoint();
+      break;
+  }
+
+}
+
+void CSolver::UnpackComms_Point(CGeometry *geometry, unsigned short commType, unsigned long iPoint, const su2double *rotMatrix, su2double *buf) {
+
+  unsigned short iVar, iDim, jDim;
+  su2double Rotated[3];
+
+  /*--- Periodic transformation, in place in the receive buffer. The entries 1 to nDim
+   of the solution-like quantities of the flow solvers are the momentum (or velocity)
+   components, and the gradients are rotated for every variable. ---*/
+
+  if (Periodic_Vectors &&
+      ((commType == COMM_SOLUTION) || (commType == COMM_SOLUTION_OLD) ||
+       (commType == COMM_SOLUTION_LIMITER) || (commType == COMM_UNDIVIDED_LAPLACIAN) ||
+       (commType == COMM_PRIMITIVE_LIMITER))) {
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Rotated[iDim] = rotMatrix[iDim*3]*buf[1];
+      for (jDim = 1; jDim < nDim; jDim++)
+        Rotated[iDim] += rotMatrix[iDim*3+jDim]*buf[jDim+1];
+    }
+    for (iDim = 0; iDim < nDim; iDim++) buf[iDim+1] = Rotated[iDim];
+  }
+
+  if ((commType == COMM_SOLUTION_GRADIENT) || (commType == COMM_PRIMITIVE_GRADIENT)) {
+    for (iVar = 0; iVar < GetComms_CountPerPoint(commType)/nDim; iVar++) {
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Rotated[iDim] = rotMatrix[iDim*3]*buf[iVar*nDim];
+        for (jDim = 1; jDim < nDim; jDim++)
+          Rotated[iDim] += rotMatrix[iDim*3+jDim]*buf[iVar*nDim+jDim];
+      }
+      for (iDim = 0; iDim < nDim; iDim++) buf[iVar*nDim+iDim] = Rotated[iDim];
+    }
+  }
+
+  switch (commType) {
+    case COMM_SOLUTION:
+      for (iVar = 0; iVar < nVar; iVar++) node[iPoint]->SetSolution(iVar, buf[iVar]);
+      break;
+    case COMM_SOLUTION_OLD:
+      for (iVar = 0; iVar < nVar; iVar++) node[iPoint]->SetSolution_Old(iVar, buf[iVar]);
+      break;
+    case COMM_SOLUTION_EDDY:
+      for (iVar = 0; iVar < nVar; iVar++) node[iPoint]->SetSolution(iVar, buf[iVar]);
+      node[iPoint]->SetmuT(buf[nVar]);
+      break;
+    case COMM_SOLUTION_GRADIENT:
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (iDim = 0; iDim < nDim; iDim++)
+          node[iPoint]->SetGradient(iVar, iDim, buf[iVar*nDim+iDim]);
+      break;
+    case COMM_SOLUTION_LIMITER:
+      for (iVar = 0; iVar < nVar; iVar++) node[iPoint]->SetLimiter(iVar, buf[iVar]);
+      break;
+    case COMM_PRIMITIVE_GRADIENT:
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+        for (iDim = 0; iDim < nDim; iDim++)
+          node[iPoint]->SetGradient_Primitive(iVar, iDim, buf[iVar*nDim+iDim]);
+      break;
+    case COMM_PRIMITIVE_LIMITER:
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++) node[iPoint]->SetLimiter_Primitive(iVar, buf[iVar]);
+      break;
+    case COMM_UNDIVIDED_LAPLACIAN:
+      for (iVar = 0; iVar < nVar; iVar++) node[iPoint]->SetUndivided_Laplacian(iVar, buf[iVar]);
+      break;
+    case COMM_SENSOR:
+      node[iPoint]->SetSensor(buf[0]);
+      break;
+    case COMM_MAX_EIGENVALUE:
+      node[iPoint]->SetLambda(buf[0]);
+      geometry->node[iPoint]->SetnNeighbor(SU2_TYPE::Int(buf[1]));
+      break;
+  }
+
+}
+
 void CSolver::SetResidual_RMS(CGeometry *geometry, CConfig *config) {
   unsigned short iVar;
   
@@ -215,72 +447,61 @@ void CSolver::SetResidual_RMS(CGeometry *geometry, CConfig *config) {
   
   int nProcessor = size, iProcessor;
 
-  su2double *sbuf_residual, *rbuf_residual, *sbuf_coord, *rbuf_coord, *Coord;
-  unsigned long *sbuf_point, *rbuf_point, Local_nPointDomain, Global_nPointDomain;
-  unsigned short iDim;
+  su2double *sbuf_residual, *rbuf_residual, *Coord, Global_nPointDomain;
+  unsigned short iDim, nRecord = nDim+2;
+  CSumReduction Residual;
   
-  /*--- Set the L2 Norm residual in all the processors ---*/
+  /*--- Set the L2 Norm residual in all the processors, the number of points
+   of the domain is summed in the same reduction as the residuals ---*/
   
-  sbuf_residual  = new su2double[nVar]; for (iVar = 0; iVar < nVar; iVar++) sbuf_residual[iVar] = 0.0;
-  rbuf_residual  = new su2double[nVar]; for (iVar = 0; iVar < nVar; iVar++) rbuf_residual[iVar] = 0.0;
+  sbuf_residual = new su2double[nVar];
   
   for (iVar = 0; iVar < nVar; iVar++) sbuf_residual[iVar] = GetRes_RMS(iVar);
-  Local_nPointDomain = geometry->GetnPointDomain();
-  
-  
-  SU2_MPI::Allreduce(sbuf_residual, rbuf_residual, nVar, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&Local_nPointDomain, &Global_nPointDomain, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+  Global_nPointDomain = geometry->GetnPointDomain();
   
+  Residual.Add(sbuf_residual, nVar);
+  Residual.Add(&Global_nPointDomain);
+  Residual.Reduce();
   
   for (iVar = 0; iVar < nVar; iVar++) {
     
-    if (rbuf_residual[iVar] != rbuf_residual[iVar]) {
+    if (sbuf_residual[iVar] != sbuf_residual[iVar]) {
       SU2_MPI::Error("SU2 has diverged. (NaN detected)", CURRENT_FUNCTION);
     }
     
-    SetRes_RMS(iVar, max(EPS*EPS, sqrt(rbuf_residual[iVar]/Global_nPointDomain)));
+    SetRes_RMS(iVar, max(EPS*EPS, sqrt(sbuf_residual[iVar]/Global_nPointDomain)));
     
   }
   
   delete [] sbuf_residual;
-  delete [] rbuf_residual;
   
-  /*--- Set the Maximum residual in all the processors ---*/
-  sbuf_residual = new su2double [nVar]; for (iVar = 0; iVar < nVar; iVar++) sbuf_residual[iVar] = 0.0;
-  sbuf_point = new unsigned long [nVar]; for (iVar = 0; iVar < nVar; iVar++) sbuf_point[iVar] = 0;
-  sbuf_coord = new su2double[nVar*nDim]; for (iVar = 0; iVar < nVar*nDim; iVar++) sbuf_coord[iVar] = 0.0;
+  /*--- Set the Maximum residual in all the processors. The residual, the
+   point index and its coordinates are gathered as one record per variable,
+   the index is exactly representable in the floating point buffer ---*/
+  
+  sbuf_residual = new su2double [nVar*nRecord];
+  rbuf_residual = new su2double [nProcessor*nVar*nRecord];
   
-  rbuf_residual = new su2double [nProcessor*nVar]; for (iVar = 0; iVar < nProcessor*nVar; iVar++) rbuf_residual[iVar] = 0.0;
-  rbuf_point = new unsigned long [nProcessor*nVar]; for (iVar = 0; iVar < nProcessor*nVar; iVar++) rbuf_point[iVar] = 0;
-  rbuf_coord = new su2double[nProcessor*nVar*nDim]; for (iVar = 0; iVar < nProcessor*nVar*nDim; iVar++) rbuf_coord[iVar] = 0.0;
-
   for (iVar = 0; iVar < nVar; iVar++) {
-    sbuf_residual[iVar] = GetRes_Max(iVar);
-    sbuf_point[iVar] = GetPoint_Max(iVar);
+    sbuf_residual[iVar*nRecord]   = GetRes_Max(iVar);
+    sbuf_residual[iVar*nRecord+1] = GetPoint_Max(iVar);
     Coord = GetPoint_Max_Coord(iVar);
     for (iDim = 0; iDim < nDim; iDim++)
-      sbuf_coord[iVar*nDim+iDim] = Coord[iDim];
+      sbuf_residual[iVar*nRecord+2+iDim] = Coord[iDim];
   }
   
-  SU2_MPI::Allgather(sbuf_residual, nVar, MPI_DOUBLE, rbuf_residual, nVar, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(sbuf_point, nVar, MPI_UNSIGNED_LONG, rbuf_point, nVar, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(sbuf_coord, nVar*nDim, MPI_DOUBLE, rbuf_coord, nVar*nDim, MPI_DOUBLE, MPI_COMM_WORLD);
+  SU2_MPI::Allgather(sbuf_residual, nVar*nRecord, MPI_DOUBLE, rbuf_residual, nVar*nRecord, MPI_DOUBLE, MPI_COMM_WORLD);
 
   for (iVar = 0; iVar < nVar; iVar++) {
     for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-      AddRes_Max(iVar, rbuf_residual[iProcessor*nVar+iVar], rbuf_point[iProcessor*nVar+iVar], &rbuf_coord[iProcessor*nVar*nDim+iVar*nDim]);
+      su2double *Record = &rbuf_residual[(iProcessor*nVar+iVar)*nRecord];
+      AddRes_Max(iVar, Record[0], (unsigned long)SU2_TYPE::GetValue(Record[1]), &Record[2]);
     }
   }
   
   delete [] sbuf_residual;
   delete [] rbuf_residual;
   
-  delete [] sbuf_point;
-  delete [] rbuf_point;
-  
-  delete [] sbuf_coord;
-  delete [] rbuf_coord;
-  
 #endif
   
 }
@@ -692,13 +913,64 @@ void CSolver::SetSolution_Gradient_LS(CGeometry *geometry, CConfig *config) {
   unsigned long iPoint, jPoint;
   su2double *Coord_i, *Coord_j, *Solution_i, *Solution_j,
   r11, r12, r13, r22, r23, r23_a, r23_b, r33, weight, detR2, z11, z12, z13,
-  z22, z23, z33, product;
+  z22, z23, z33, product, *Var_i, *Var_j, *Weight, *Smatrix_i;
   bool singular = false;
   
   su2double **Cvector = new su2double* [nVar];
   for (iVar = 0; iVar < nVar; iVar++)
     Cvector[iVar] = new su2double [nDim];
   
+  /*--- Unless the coordinates are recorded for AD, the geometric part of the
+   least-squares problem is taken from the data stored in the geometry ---*/
+  
+  if (!config->GetAD_Mode()) {
+    
+    geometry->SetLeastSquares_Weights();
+    
+    for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+      
+      Var_i = node[iPoint]->GetSolution();
+      Weight = geometry->GetLeastSquares_Weights(iPoint);
+      Smatrix_i = geometry->GetLeastSquares_Smatrix(iPoint);
+      
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (iDim = 0; iDim < nDim; iDim++)
+          Cvector[iVar][iDim] = 0.0;
+      
+      /*--- Entries of c:= transpose(A)*b ---*/
+      
+      for (iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++, Weight += nDim+1) {
+        if (Weight[nDim] == 0.0) continue;
+        jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
+        Var_j = node[jPoint]->GetSolution();
+        for (iVar = 0; iVar < nVar; iVar++)
+          for (iDim = 0; iDim < nDim; iDim++)
+            Cvector[iVar][iDim] += Weight[iDim]*(Var_j[iVar]-Var_i[iVar])/Weight[nDim];
+      }
+      
+      /*--- Computation of the gradient: S*c ---*/
+      
+      for (iVar = 0; iVar < nVar; iVar++) {
+        for (iDim = 0; iDim < nDim; iDim++) {
+          product = 0.0;
+          for (jDim = 0; jDim < nDim; jDim++)
+            product += Smatrix_i[iDim*nDim+jDim]*Cvector[iVar][jDim];
+          node[iPoint]->SetGradient(iVar, iDim, product);
+        }
+      }
+      
+    }
+    
+    for (iVar = 0; iVar < nVar; iVar++)
+      delete [] Cvector[iVar];
+    delete [] Cvector;
+    
+    Set_MPI_Solution_Gradient(geometry, config);
+    
+    return;
+    
+  }
+  
   /*--- Loop over points of the grid ---*/
   
   for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
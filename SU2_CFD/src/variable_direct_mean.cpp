@@ -410,17 +410,21 @@ CEulerVariable::CEulerVariable(su2double *val_solution, unsigned short val_nDim,
 CEulerVariable::~CEulerVariable(void) {
     unsigned short iVar;
 
+  if (!Shared_Storage) {
+    if (Primitive         != NULL) delete [] Primitive;
+    if (Secondary         != NULL) delete [] Secondary;
+    if (Limiter_Primitive != NULL) delete [] Limiter_Primitive;
+  }
+
   if (HB_Source         != NULL) delete [] HB_Source;
-  if (Primitive         != NULL) delete [] Primitive;
-  if (Secondary         != NULL) delete [] Secondary;
-  if (Limiter_Primitive != NULL) delete [] Limiter_Primitive;
   if (Limiter_Secondary != NULL) delete [] Limiter_Secondary;
   if (WindGust          != NULL) delete [] WindGust;
   if (WindGustDer       != NULL) delete [] WindGustDer;
 
   if (Gradient_Primitive != NULL) {
-    for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-      if (Gradient_Primitive[iVar] != NULL) delete [] Gradient_Primitive[iVar];
+    if (!Shared_Storage)
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+        if (Gradient_Primitive[iVar] != NULL) delete [] Gradient_Primitive[iVar];
     delete [] Gradient_Primitive;
   }
   if (Gradient_Secondary != NULL) {
@@ -437,6 +441,50 @@ CEulerVariable::~CEulerVariable(void) {
 
 }
 
+void CEulerVariable::SetStorage(CVariableStorage *storage, unsigned long iPoint) {
+  
+  unsigned short iVar, iDim;
+  su2double *Shared;
+  bool owned = !Shared_Storage;
+  
+  /*--- Solution, gradient and limiter of the conservative variables ---*/
+  
+  CVariable::SetStorage(storage, iPoint);
+  
+  /*--- Primitive and secondary variables, gradient and limiter of the primitives ---*/
+  
+  Shared = storage->GetPrimitive(iPoint);
+  if ((Primitive != NULL) && (Shared != NULL)) {
+    for (iVar = 0; iVar < nPrimVar; iVar++) Shared[iVar] = Primitive[iVar];
+    if (owned) delete [] Primitive;
+    Primitive = Shared;
+  }
+  
+  Shared = storage->GetGradient_Primitive(iPoint);
+  if ((Gradient_Primitive != NULL) && (Shared != NULL)) {
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+      for (iDim = 0; iDim < nDim; iDim++) Shared[iVar*nDim+iDim] = Gradient_Primitive[iVar][iDim];
+      if (owned) delete [] Gradient_Primitive[iVar];
+      Gradient_Primitive[iVar] = &Shared[iVar*nDim];
+    }
+  }
+  
+  Shared = storage->GetLimiter_Primitive(iPoint);
+  if ((Limiter_Primitive != NULL) && (Shared != NULL)) {
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++) Shared[iVar] = Limiter_Primitive[iVar];
+    if (owned) delete [] Limiter_Primitive;
+    Limiter_Primitive = Shared;
+  }
+  
+  Shared = storage->GetSecondary(iPoint);
+  if ((Secondary != NULL) && (Shared != NULL)) {
+    for (iVar = 0; iVar < nSecondaryVar; iVar++) Shared[iVar] = Secondary[iVar];
+    if (owned) delete [] Secondary;
+    Secondary = Shared;
+  }
+  
+}
+
 void CEulerVariable::SetGradient_PrimitiveZero(unsigned short val_primvar) {
     unsigned short iVar, iDim;
   
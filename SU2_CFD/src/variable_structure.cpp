@@ -39,6 +39,77 @@
 
 unsigned short CVariable::nDim = 0;
 
+CVariableStorage::CVariableStorage(void) {
+
+  nPoint = 0;
+  nDim = 0; nVar = 0;
+  nPrimVar = 0; nPrimVarGrad = 0; nSecondaryVar = 0;
+
+  /*--- Array initialization ---*/
+  Solution = NULL;
+  Gradient = NULL;
+  Limiter = NULL;
+  Primitive = NULL;
+  Gradient_Primitive = NULL;
+  Limiter_Primitive = NULL;
+  Secondary = NULL;
+
+}
+
+CVariableStorage::~CVariableStorage(void) {
+
+  if (Solution           != NULL) delete [] Solution;
+  if (Gradient           != NULL) delete [] Gradient;
+  if (Limiter            != NULL) delete [] Limiter;
+  if (Primitive          != NULL) delete [] Primitive;
+  if (Gradient_Primitive != NULL) delete [] Gradient_Primitive;
+  if (Limiter_Primitive  != NULL) delete [] Limiter_Primitive;
+  if (Secondary          != NULL) delete [] Secondary;
+
+}
+
+void CVariableStorage::Initialize(unsigned long val_npoint, unsigned short val_ndim, unsigned short val_nvar,
+                                  unsigned short val_nprimvar, unsigned short val_nprimvargrad, unsigned short val_nsecondaryvar) {
+
+  unsigned long iElem;
+
+  nPoint        = val_npoint;
+  nDim          = val_ndim;
+  nVar          = val_nvar;
+  nPrimVar      = val_nprimvar;
+  nPrimVarGrad  = val_nprimvargrad;
+  nSecondaryVar = val_nsecondaryvar;
+
+  /*--- All the fields are laid out point-major, i.e. the values of one
+   point are contiguous and consecutive points follow each other. ---*/
+
+  if (nVar > 0) {
+    Solution = new su2double [nPoint*nVar];
+    Gradient = new su2double [nPoint*nVar*nDim];
+    Limiter  = new su2double [nPoint*nVar];
+    for (iElem = 0; iElem < nPoint*nVar; iElem++) { Solution[iElem] = 0.0; Limiter[iElem] = 0.0; }
+    for (iElem = 0; iElem < nPoint*nVar*nDim; iElem++) Gradient[iElem] = 0.0;
+  }
+
+  if (nPrimVar > 0) {
+    Primitive = new su2double [nPoint*nPrimVar];
+    for (iElem = 0; iElem < nPoint*nPrimVar; iElem++) Primitive[iElem] = 0.0;
+  }
+
+  if (nPrimVarGrad > 0) {
+    Gradient_Primitive = new su2double [nPoint*nPrimVarGrad*nDim];
+    Limiter_Primitive  = new su2double [nPoint*nPrimVarGrad];
+    for (iElem = 0; iElem < nPoint*nPrimVarGrad*nDim; iElem++) Gradient_Primitive[iElem] = 0.0;
+    for (iElem = 0; iElem < nPoint*nPrimVarGrad; iElem++) Limiter_Primitive[iElem] = 0.0;
+  }
+
+  if (nSecondaryVar > 0) {
+    Secondary = new su2double [nPoint*nSecondaryVar];
+    for (iElem = 0; iElem < nPoint*nSecondaryVar; iElem++) Secondary[iElem] = 0.0;
+  }
+
+}
+
 CVariable::CVariable(void) {
 
   /*--- Array initialization ---*/
@@ -56,6 +127,7 @@ CVariable::CVariable(void) {
   Residual_Old = NULL;
   Residual_Sum = NULL;
   Solution_Adj_Old = NULL;
+  Shared_Storage = false;
   
 }
 
@@ -76,6 +148,7 @@ CVariable::CVariable(unsigned short val_nvar, CConfig *config) {
   Residual_Old = NULL;
   Residual_Sum = NULL;
   Solution_Adj_Old = NULL;
+  Shared_Storage = false;
 
   /*--- Initialize the number of solution variables. This version
    of the constructor will be used primarily for converting the
@@ -110,6 +183,7 @@ CVariable::CVariable(unsigned short val_nDim, unsigned short val_nvar, CConfig *
   Residual_Old = NULL;
   Residual_Sum = NULL;
   Solution_Adj_Old = NULL;
+  Shared_Storage = false;
   
   /*--- Initializate the number of dimension and number of variables ---*/
   nDim = val_nDim;
@@ -147,11 +221,16 @@ CVariable::CVariable(unsigned short val_nDim, unsigned short val_nvar, CConfig *
 CVariable::~CVariable(void) {
   unsigned short iVar;
 
-  if (Solution            != NULL) delete [] Solution;
+  /*--- Fields living in a CVariableStorage are released by the solver ---*/
+
+  if (!Shared_Storage) {
+    if (Solution != NULL) delete [] Solution;
+    if (Limiter  != NULL) delete [] Limiter;
+  }
+
   if (Solution_Old        != NULL) delete [] Solution_Old;
   if (Solution_time_n     != NULL) delete [] Solution_time_n;
   if (Solution_time_n1    != NULL) delete [] Solution_time_n1;
-  if (Limiter             != NULL) delete [] Limiter;
   if (Solution_Max        != NULL) delete [] Solution_Max;
   if (Solution_Min        != NULL) delete [] Solution_Min;
   if (Grad_AuxVar         != NULL) delete [] Grad_AuxVar;
@@ -162,13 +241,49 @@ CVariable::~CVariable(void) {
   if (Solution_Adj_Old    != NULL) delete [] Solution_Adj_Old;
   
   if (Gradient != NULL) {
-    for (iVar = 0; iVar < nVar; iVar++)
-      delete [] Gradient[iVar];
+    if (!Shared_Storage)
+      for (iVar = 0; iVar < nVar; iVar++)
+        delete [] Gradient[iVar];
     delete [] Gradient;
   }
 
 }
 
+void CVariable::SetStorage(CVariableStorage *storage, unsigned long iPoint) {
+  
+  unsigned short iVar, iDim;
+  su2double *Shared;
+  
+  /*--- Copy the current values into the container and point the
+   variable to its slice, the per-point arrays are released. ---*/
+  
+  Shared = storage->GetSolution(iPoint);
+  if ((Solution != NULL) && (Shared != NULL)) {
+    for (iVar = 0; iVar < nVar; iVar++) Shared[iVar] = Solution[iVar];
+    if (!Shared_Storage) delete [] Solution;
+    Solution = Shared;
+  }
+  
+  Shared = storage->GetGradient(iPoint);
+  if ((Gradient != NULL) && (Shared != NULL)) {
+    for (iVar = 0; iVar < nVar; iVar++) {
+      for (iDim = 0; iDim < nDim; iDim++) Shared[iVar*nDim+iDim] = Gradient[iVar][iDim];
+      if (!Shared_Storage) delete [] Gradient[iVar];
+      Gradient[iVar] = &Shared[iVar*nDim];
+    }
+  }
+  
+  Shared = storage->GetLimiter(iPoint);
+  if ((Limiter != NULL) && (Shared != NULL)) {
+    for (iVar = 0; iVar < nVar; iVar++) Shared[iVar] = Limiter[iVar];
+    if (!Shared_Storage) delete [] Limiter;
+    Limiter = Shared;
+  }
+  
+  Shared_Storage = true;
+  
+}
+
 void CVariable::AddUnd_Lapl(su2double *val_und_lapl) {
   for (unsigned short iVar = 0; iVar < nVar; iVar++)
     Undivided_Laplacian[iVar] += val_und_lapl[iVar];